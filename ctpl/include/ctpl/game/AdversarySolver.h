@@ -0,0 +1,499 @@
+#pragma once
+
+#include <ctpl/graph/IGraph.h>
+#include <ctpl/graph/algo.h>
+#include <ctpl/graph/queues.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ctpl::game {
+    struct AdversarySolverOptions {
+        // threads the traveller moves from the source are split between
+        std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        // the transposition table has 2^table_size_log2 entries
+        std::size_t table_size_log2 = 20;
+        std::uint64_t seed = 0x9e3779b97f4a7c15ULL;
+    };
+
+    /**
+     * @brief Exact solver of the traveller/adversary game with a ban budget k.
+     *
+     * The traveller starts in the source and moves along non-banned edges paying their weights. After every step
+     * the adversary may ban edges while it has budget left, but the target must stay reachable from the traveller.
+     * The value of the game is the cost the best traveller pays against the best adversary. It's found with
+     * an alpha-beta search over (position, banned edges) states memoized in a Zobrist-hashed transposition table,
+     * the traveller moves from the source are split between threads.
+     *
+     * The graph is copied on construction, so it may be changed afterwards.
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class AdversarySolver {
+    public:
+        using dist_t = distance_t<edge_props_t>;
+        using edge_t = std::pair<vertex_t, vertex_t>;
+        static constexpr dist_t INFINITE_COST = std::numeric_limits<dist_t>::max();
+
+        struct Result {
+            // cost of the traveller against the optimal adversary
+            dist_t value;
+            // source-target distance without bans
+            dist_t offline_optimum;
+            // value / offline_optimum
+            double ratio;
+        };
+
+        AdversarySolver(const IGraph<vertex_t, edge_props_t>& graph, vertex_t source, vertex_t target,
+                        std::size_t ban_budget, AdversarySolverOptions options = {})
+                : ban_budget_(ban_budget), options_(options), table_(options.table_size_log2) {
+            auto index_of = [&](vertex_t u) {
+                auto [it, inserted] = index_.try_emplace(u, static_cast<std::uint32_t>(vertices_.size()));
+                if (inserted) {
+                    vertices_.push_back(u);
+                    adj_.emplace_back();
+                    reverse_adj_.emplace_back();
+                }
+                return it->second;
+            };
+            source_ = index_of(source);
+            target_ = index_of(target);
+            graph.visitAllEdges([&](vertex_t u, vertex_t v, edge_props_t props) {
+                auto a = index_of(u);
+                auto b = index_of(v);
+                auto e = static_cast<std::uint32_t>(edges_.size());
+                dist_t w = edgeLength(props);
+                edges_.push_back({a, b});
+                edge_index_[edgeKey(a, b)] = e;
+                adj_[a].push_back({b, e, w});
+                reverse_adj_[b].push_back({a, e, w});
+                if constexpr (has_prop<Undirected, edge_props_t>) {
+                    edge_index_[edgeKey(b, a)] = e;
+                    adj_[b].push_back({a, e, w});
+                    reverse_adj_[a].push_back({b, e, w});
+                }
+            });
+
+            std::mt19937_64 rng(options_.seed);
+            for (std::size_t i = 0; i < vertices_.size(); i++) {
+                position_keys_.push_back(rng());
+            }
+            for (std::size_t i = 0; i < edges_.size(); i++) {
+                edge_keys_.push_back(rng());
+            }
+            adversary_key_ = rng();
+
+            computeLowerBounds();
+
+            // bans of the edges of shortest paths are tried first, they are the most likely to hurt
+            for (std::uint32_t e = 0; e < edges_.size(); e++) {
+                ban_order_.push_back(e);
+            }
+            std::stable_sort(ban_order_.begin(), ban_order_.end(), [&](std::uint32_t lhs, std::uint32_t rhs) {
+                return isTight(lhs) > isTight(rhs);
+            });
+        }
+
+        /**
+         * @brief Computes the value of the game from the source
+         */
+        Result solve() {
+            dist_t value = solveRoot();
+            dist_t optimum = lower_bound_[source_];
+            double ratio = optimum == 0 ? (value == 0 ? 1.0 : std::numeric_limits<double>::infinity())
+                                        : static_cast<double>(value) / static_cast<double>(optimum);
+            return {value, optimum, ratio};
+        }
+
+        /**
+         * @brief Optimal adversary move: the edges to ban right after the traveller has stepped to position
+         * @param banned edges banned so far
+         */
+        std::vector<edge_t> bestBans(vertex_t position, const std::vector<edge_t>& banned) {
+            Context ctx = makeContext();
+            for (const auto& [u, v] : banned) {
+                if (auto e = findEdge(u, v)) {
+                    ban(ctx, *e);
+                }
+            }
+
+            std::vector<edge_t> res;
+            auto it = index_.find(position);
+            if (it == index_.end() || it->second == target_) {
+                return res;
+            }
+            std::uint32_t q = it->second;
+
+            while (ctx.bans_used < ban_budget_) {
+                dist_t best = traveller(ctx, q, 0, INFINITE_COST).value;
+                std::optional<std::uint32_t> best_edge;
+                for (std::uint32_t e : ban_order_) {
+                    if (ctx.banned[e]) {
+                        continue;
+                    }
+                    ban(ctx, e);
+                    if (isTargetReachable(ctx, q)) {
+                        dist_t value = adversary(ctx, q, 0, INFINITE_COST).value;
+                        if (value > best) {
+                            best = value;
+                            best_edge = e;
+                        }
+                    }
+                    unban(ctx, e);
+                }
+                if (!best_edge) {
+                    break;
+                }
+                ban(ctx, *best_edge);
+                res.push_back({vertices_[edges_[*best_edge].first], vertices_[edges_[*best_edge].second]});
+            }
+            return res;
+        }
+
+    private:
+        struct Arc {
+            std::uint32_t to;
+            std::uint32_t edge;
+            dist_t weight;
+        };
+
+        struct SearchResult {
+            dist_t value;
+            // value was affected by a repetition cutoff, so it's valid only for the current search path
+            bool path_dependent;
+        };
+
+        struct Context {
+            std::vector<char> banned;
+            std::size_t bans_used = 0;
+            std::uint64_t key = 0;
+            std::unordered_set<std::uint64_t> path;
+            std::vector<std::uint32_t> queue;
+            std::vector<char> seen;
+        };
+
+        enum class Bound : std::uint8_t {
+            EXACT,
+            LOWER,
+            UPPER
+        };
+
+        class TranspositionTable {
+            struct Entry {
+                std::uint64_t key = 0;
+                dist_t value = 0;
+                Bound bound = Bound::EXACT;
+                bool used = false;
+            };
+
+            static constexpr std::size_t LOCK_COUNT = 64;
+        public:
+            explicit TranspositionTable(std::size_t size_log2) : entries_(std::size_t{1} << size_log2),
+                                                                 locks_(LOCK_COUNT) {
+            }
+
+            std::optional<Entry> probe(std::uint64_t key) {
+                std::size_t i = key & (entries_.size() - 1);
+                std::lock_guard lock(locks_[i % LOCK_COUNT]);
+                if (entries_[i].used && entries_[i].key == key) {
+                    return entries_[i];
+                }
+                return std::nullopt;
+            }
+
+            void store(std::uint64_t key, dist_t value, Bound bound) {
+                std::size_t i = key & (entries_.size() - 1);
+                std::lock_guard lock(locks_[i % LOCK_COUNT]);
+                entries_[i] = {key, value, bound, true};
+            }
+
+        private:
+            std::vector<Entry> entries_;
+            std::vector<std::mutex> locks_;
+        };
+
+        static std::uint64_t edgeKey(std::uint32_t a, std::uint32_t b) {
+            return (static_cast<std::uint64_t>(a) << 32) | b;
+        }
+
+        static dist_t add(dist_t a, dist_t b) {
+            return a == INFINITE_COST || b == INFINITE_COST ? INFINITE_COST : a + b;
+        }
+
+        // window of a child reached over an edge of weight w, 0 is used as "no lower bound"
+        static dist_t sub(dist_t a, dist_t w) {
+            return a == INFINITE_COST ? INFINITE_COST : (a > w ? a - w : 0);
+        }
+
+        static Bound boundOf(dist_t value, dist_t alpha, dist_t beta) {
+            if (value >= beta) {
+                return Bound::LOWER;
+            }
+            if (value <= alpha) {
+                return Bound::UPPER;
+            }
+            return Bound::EXACT;
+        }
+
+        std::optional<dist_t> probe(std::uint64_t key, dist_t alpha, dist_t beta) {
+            auto entry = table_.probe(key);
+            if (!entry) {
+                return std::nullopt;
+            }
+            if (entry->bound == Bound::EXACT ||
+                (entry->bound == Bound::LOWER && entry->value >= beta) ||
+                (entry->bound == Bound::UPPER && entry->value <= alpha)) {
+                return entry->value;
+            }
+            return std::nullopt;
+        }
+
+        std::optional<std::uint32_t> findEdge(vertex_t u, vertex_t v) const {
+            auto a = index_.find(u);
+            auto b = index_.find(v);
+            if (a == index_.end() || b == index_.end()) {
+                return std::nullopt;
+            }
+            if (auto it = edge_index_.find(edgeKey(a->second, b->second)); it != edge_index_.end()) {
+                return it->second;
+            }
+            return std::nullopt;
+        }
+
+        bool isTight(std::uint32_t e) const {
+            auto [a, b] = edges_[e];
+            for (const Arc& arc : adj_[a]) {
+                if (arc.edge == e && lower_bound_[b] != INFINITE_COST &&
+                    add(arc.weight, lower_bound_[b]) == lower_bound_[a]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void computeLowerBounds() {
+            lower_bound_.assign(vertices_.size(), INFINITE_COST);
+            BinaryHeapQueue<dist_t, std::uint32_t> queue;
+            queue.push(0, target_);
+            while (!queue.empty()) {
+                auto [dist, u] = queue.pop();
+                if (lower_bound_[u] != INFINITE_COST) {
+                    continue;
+                }
+                lower_bound_[u] = dist;
+                for (const Arc& arc : reverse_adj_[u]) {
+                    if (lower_bound_[arc.to] == INFINITE_COST) {
+                        queue.push(dist + arc.weight, arc.to);
+                    }
+                }
+            }
+        }
+
+        Context makeContext() const {
+            Context ctx;
+            ctx.banned.assign(edges_.size(), false);
+            ctx.seen.assign(vertices_.size(), false);
+            return ctx;
+        }
+
+        void ban(Context& ctx, std::uint32_t e) const {
+            ctx.banned[e] = true;
+            ++ctx.bans_used;
+            ctx.key ^= edge_keys_[e];
+        }
+
+        void unban(Context& ctx, std::uint32_t e) const {
+            ctx.banned[e] = false;
+            --ctx.bans_used;
+            ctx.key ^= edge_keys_[e];
+        }
+
+        bool isTargetReachable(Context& ctx, std::uint32_t from) const {
+            std::fill(ctx.seen.begin(), ctx.seen.end(), false);
+            ctx.queue.assign(1, from);
+            ctx.seen[from] = true;
+            for (std::size_t i = 0; i < ctx.queue.size(); i++) {
+                std::uint32_t u = ctx.queue[i];
+                if (u == target_) {
+                    return true;
+                }
+                for (const Arc& arc : adj_[u]) {
+                    if (!ctx.banned[arc.edge] && !ctx.seen[arc.to]) {
+                        ctx.seen[arc.to] = true;
+                        ctx.queue.push_back(arc.to);
+                    }
+                }
+            }
+            return false;
+        }
+
+        struct Move {
+            dist_t bound;
+            const Arc* arc;
+        };
+
+        std::vector<Move> travellerMoves(const Context& ctx, std::uint32_t p) const {
+            std::vector<Move> moves;
+            for (const Arc& arc : adj_[p]) {
+                if (!ctx.banned[arc.edge] && lower_bound_[arc.to] != INFINITE_COST) {
+                    moves.push_back({add(arc.weight, lower_bound_[arc.to]), &arc});
+                }
+            }
+            std::sort(moves.begin(), moves.end(), [](const Move& lhs, const Move& rhs) {
+                return lhs.bound < rhs.bound;
+            });
+            return moves;
+        }
+
+        // traveller stands in p and is to move, the result is minimized
+        SearchResult traveller(Context& ctx, std::uint32_t p, dist_t alpha, dist_t beta) {
+            if (p == target_) {
+                return {0, false};
+            }
+            std::uint64_t key = ctx.key ^ position_keys_[p];
+            // returning to the same state never helps the traveller
+            if (ctx.path.contains(key)) {
+                return {INFINITE_COST, true};
+            }
+            if (auto value = probe(key, alpha, beta)) {
+                return {*value, false};
+            }
+
+            dist_t best = INFINITE_COST;
+            bool path_dependent = false;
+            ctx.path.insert(key);
+            for (const Move& move : travellerMoves(ctx, p)) {
+                dist_t limit = std::min(best, beta);
+                if (move.bound >= limit) {
+                    best = std::min(best, move.bound);
+                    break;
+                }
+                auto res = adversary(ctx, move.arc->to, sub(alpha, move.arc->weight), sub(limit, move.arc->weight));
+                path_dependent |= res.path_dependent;
+                best = std::min(best, add(move.arc->weight, res.value));
+                if (best <= alpha) {
+                    break;
+                }
+            }
+            ctx.path.erase(key);
+
+            if (!path_dependent) {
+                table_.store(key, best, boundOf(best, alpha, beta));
+            }
+            return {best, path_dependent};
+        }
+
+        // traveller has just stepped to q, adversary may ban more edges, the result is maximized
+        SearchResult adversary(Context& ctx, std::uint32_t q, dist_t alpha, dist_t beta) {
+            if (q == target_) {
+                return {0, false};
+            }
+            std::uint64_t key = ctx.key ^ position_keys_[q] ^ adversary_key_;
+            if (auto value = probe(key, alpha, beta)) {
+                return {*value, false};
+            }
+
+            auto pass = traveller(ctx, q, alpha, beta);
+            dist_t best = pass.value;
+            bool path_dependent = pass.path_dependent;
+            if (ctx.bans_used < ban_budget_) {
+                for (std::uint32_t e : ban_order_) {
+                    if (best >= beta) {
+                        break;
+                    }
+                    if (ctx.banned[e]) {
+                        continue;
+                    }
+                    ban(ctx, e);
+                    if (isTargetReachable(ctx, q)) {
+                        auto res = adversary(ctx, q, std::max(alpha, best), beta);
+                        path_dependent |= res.path_dependent;
+                        best = std::max(best, res.value);
+                    }
+                    unban(ctx, e);
+                }
+            }
+
+            if (!path_dependent) {
+                table_.store(key, best, boundOf(best, alpha, beta));
+            }
+            return {best, path_dependent};
+        }
+
+        dist_t solveRoot() {
+            if (source_ == target_) {
+                return 0;
+            }
+            Context root = makeContext();
+            std::uint64_t root_key = position_keys_[source_];
+            std::vector<Move> moves = travellerMoves(root, source_);
+            std::atomic<dist_t> best = INFINITE_COST;
+            std::atomic<std::size_t> next_move = 0;
+
+            auto worker = [&](std::size_t max_moves) {
+                Context ctx = makeContext();
+                ctx.path.insert(root_key);
+                for (std::size_t done = 0; done < max_moves; done++) {
+                    std::size_t i = next_move++;
+                    if (i >= moves.size()) {
+                        return;
+                    }
+                    const Move& move = moves[i];
+                    dist_t limit = best.load();
+                    if (move.bound >= limit) {
+                        continue;
+                    }
+                    auto res = adversary(ctx, move.arc->to, 0, sub(limit, move.arc->weight));
+                    dist_t value = add(move.arc->weight, res.value);
+                    while (value < limit && !best.compare_exchange_weak(limit, value)) {
+                    }
+                }
+            };
+
+            // the most promising move is searched alone to get a tight bound for the rest
+            worker(1);
+            StatsCollector collector;
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1; i < options_.threads; i++) {
+                threads.emplace_back([&]() {
+                    worker(moves.size());
+                    collector.collect();
+                });
+            }
+            worker(moves.size());
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            collector.mergeIntoCaller();
+
+            table_.store(root_key, best, Bound::EXACT);
+            return best;
+        }
+
+        std::size_t ban_budget_;
+        AdversarySolverOptions options_;
+        std::uint32_t source_ = 0;
+        std::uint32_t target_ = 0;
+        std::vector<vertex_t> vertices_{};
+        std::unordered_map<vertex_t, std::uint32_t> index_{};
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> edges_{};
+        std::unordered_map<std::uint64_t, std::uint32_t> edge_index_{};
+        std::vector<std::vector<Arc>> adj_{};
+        std::vector<std::vector<Arc>> reverse_adj_{};
+        std::vector<dist_t> lower_bound_{};
+        std::vector<std::uint32_t> ban_order_{};
+        std::vector<std::uint64_t> position_keys_{};
+        std::vector<std::uint64_t> edge_keys_{};
+        std::uint64_t adversary_key_ = 0;
+        TranspositionTable table_;
+    };
+}
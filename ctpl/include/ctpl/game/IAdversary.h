@@ -2,6 +2,9 @@
 
 #include <ctpl/game/IBanValidator.h>
 #include <memory>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace ctpl::game {
     template<typename vertex_t>
@@ -19,6 +22,13 @@ namespace ctpl::game {
             return validator_.requestBanEdge(u, v);
         }
 
+        /**
+         * @brief Bans several edges as one batch, see IBanValidator::requestBanEdges
+         */
+        std::vector<bool> tryBanEdges(std::span<const std::pair<vertex_t, vertex_t>> edges) {
+            return validator_.requestBanEdges(edges);
+        }
+
     private:
         IBanValidator<vertex_t>& validator_;
     };
@@ -2,8 +2,19 @@
 
 #include <ctpl/graph/IDynamicGraph.h>
 #include <ctpl/game/ITraveller.h>
+#include <ctpl/util/assert.h>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace ctpl::game {
+    template<typename vertex_t>
+    struct BanRequest {
+        vertex_t u;
+        vertex_t v;
+        bool accepted;
+    };
+
     template<typename vertex_t>
     class IBanValidator {
     public:
@@ -11,12 +22,53 @@ namespace ctpl::game {
         }
 
         bool requestBanEdge(vertex_t u, vertex_t v) {
-            if (tryRemoveEdge(u, v)) {
+            bool accepted = tryRemoveEdge(u, v);
+            ban_log_.push_back({u, v, accepted});
+            if (accepted) {
                 traveller_.notifyBanned(u, v);
-                return true;
             }
 
-            return false;
+            return accepted;
+        }
+
+        /**
+         * @brief Requests the bans as one batch: the validator removes them with a single tryRemoveEdges call
+         * and the traveller gets the accepted ones with a single notifyBannedBatch call
+         * @return whether each ban is accepted
+         */
+        std::vector<bool> requestBanEdges(std::span<const std::pair<vertex_t, vertex_t>> edges) {
+            std::vector<bool> accepted = tryRemoveEdges(edges);
+            CTPL_ASSERT(accepted.size() == edges.size(), "every ban must be either accepted or rejected");
+            std::vector<std::pair<vertex_t, vertex_t>> banned;
+            for (std::size_t i = 0; i < edges.size(); i++) {
+                ban_log_.push_back({edges[i].first, edges[i].second, accepted[i]});
+                if (accepted[i]) {
+                    banned.push_back(edges[i]);
+                }
+            }
+            if (!banned.empty()) {
+                traveller_.notifyBannedBatch(banned);
+            }
+            return accepted;
+        }
+
+        /**
+         * @return all ban requests in the order they were made
+         */
+        [[nodiscard]]
+        const std::vector<BanRequest<vertex_t>>& banLog() const noexcept {
+            return ban_log_;
+        }
+
+        [[nodiscard]]
+        std::vector<std::pair<vertex_t, vertex_t>> bannedEdges() const {
+            std::vector<std::pair<vertex_t, vertex_t>> res;
+            for (const auto& request : ban_log_) {
+                if (request.accepted) {
+                    res.push_back({request.u, request.v});
+                }
+            }
+            return res;
         }
 
         virtual ~IBanValidator() = default;
@@ -24,7 +76,22 @@ namespace ctpl::game {
     protected:
         virtual bool tryRemoveEdge(vertex_t u, vertex_t v) = 0;
 
+        /**
+         * @brief Validates and removes a batch of edges, a ban is validated as if the previous ones of the batch
+         * were already applied. Override it to apply the accepted bans at once, e.g. with IDynamicGraph::applyMutations
+         * @return whether each ban is accepted
+         */
+        virtual std::vector<bool> tryRemoveEdges(std::span<const std::pair<vertex_t, vertex_t>> edges) {
+            std::vector<bool> res;
+            res.reserve(edges.size());
+            for (const auto& [u, v] : edges) {
+                res.push_back(tryRemoveEdge(u, v));
+            }
+            return res;
+        }
+
     private:
         ITraveller<vertex_t>& traveller_;
+        std::vector<BanRequest<vertex_t>> ban_log_{};
     };
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <span>
+#include <utility>
+
 namespace ctpl::game {
     template<typename vertex_t>
     class ITraveller {
@@ -9,5 +12,14 @@ namespace ctpl::game {
         virtual vertex_t makeStep(vertex_t current_vertex) = 0;
 
         virtual void notifyBanned(vertex_t u, vertex_t v) {}
+
+        /**
+         * @brief Accepted bans of a single batch, travellers with caches override it to invalidate them once
+         */
+        virtual void notifyBannedBatch(std::span<const std::pair<vertex_t, vertex_t>> edges) {
+            for (const auto& [u, v] : edges) {
+                notifyBanned(u, v);
+            }
+        }
     };
 }
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <ctpl/game/AdversarySolver.h>
+#include <ctpl/game/IAdversary.h>
+#include <vector>
+
+namespace ctpl::game {
+    /**
+     * @brief Adversary playing the optimal ban policy computed by AdversarySolver
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class OptimalAdversary : public IAdversary<vertex_t> {
+        using super = IAdversary<vertex_t>;
+    public:
+        OptimalAdversary(IBanValidator<vertex_t>& validator, AdversarySolver<vertex_t, edge_props_t>& solver)
+                : super(validator), solver_(solver) {
+        }
+
+        void notifyTravellerStep(vertex_t, vertex_t v) override {
+            auto bans = solver_.bestBans(v, banned_);
+            auto accepted = super::tryBanEdges(bans);
+            for (std::size_t i = 0; i < bans.size(); i++) {
+                if (accepted[i]) {
+                    banned_.push_back(bans[i]);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        const std::vector<std::pair<vertex_t, vertex_t>>& banned() const noexcept {
+            return banned_;
+        }
+
+    private:
+        AdversarySolver<vertex_t, edge_props_t>& solver_;
+        std::vector<std::pair<vertex_t, vertex_t>> banned_{};
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <ctpl/game/common.h>
+#include <ctpl/graph/FilteredGraph.h>
+#include <ctpl/graph/IGraph.h>
+#include <ctpl/graph/algo.h>
+#include <ctpl/util/parallel.h>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ctpl::game {
+    /**
+     * @brief What is needed to evaluate a finished round: the traveller path (Round::run result)
+     * and the edges banned during the round (IBanValidator::bannedEdges)
+     */
+    template<typename vertex_t>
+    struct RoundRecord {
+        std::vector<vertex_t> path;
+        std::vector<std::pair<vertex_t, vertex_t>> bans;
+    };
+
+    template<typename dist_t>
+    struct RoundEvaluation {
+        // cost of the traveller path
+        dist_t walked;
+        // shortest path length with all bans applied, nullopt if the bans disconnect the path endpoints
+        std::optional<dist_t> offline_optimum;
+        // walked / offline_optimum, NaN if there is no offline optimum
+        double ratio;
+    };
+
+    struct RatioSummary {
+        std::size_t rounds = 0;
+        // rounds without offline optimum, they are excluded from the statistics
+        std::size_t undefined = 0;
+        double mean = 0;
+        double geometric_mean = 0;
+        double min = 0;
+        double max = 0;
+
+        static RatioSummary of(std::span<const double> ratios);
+
+        [[nodiscard]]
+        std::string toString() const;
+    };
+
+    /**
+     * @param graph the graph the round has been played on, before any bans
+     */
+    template<typename vertex_t, typename edge_props_t>
+    RoundEvaluation<distance_t<edge_props_t>>
+    evaluateRound(const IGraph<vertex_t, edge_props_t>& graph, const RoundRecord<vertex_t>& round) {
+        using dist_t = distance_t<edge_props_t>;
+        if (round.path.empty()) {
+            throw RoundEvaluationException("traveller path is empty");
+        }
+
+        dist_t walked = 0;
+        for (std::size_t i = 0; i + 1 < round.path.size(); i++) {
+            auto props = graph.getEdgeProps(round.path[i], round.path[i + 1]);
+            if (!props) {
+                throw RoundEvaluationException(
+                        std::format("traveller path edge ({}, {}) doesn't belong to the graph", round.path[i], round.path[i + 1]));
+            }
+            walked += edgeLength(*props);
+        }
+
+        FilteredGraph<vertex_t, edge_props_t> banned_graph(graph);
+        for (const auto& [u, v] : round.bans) {
+            banned_graph.hideEdge(u, v);
+        }
+        auto optimum = shortestPathLength<vertex_t, edge_props_t>(banned_graph, round.path.front(), round.path.back());
+
+        double ratio = std::numeric_limits<double>::quiet_NaN();
+        if (optimum) {
+            if (*optimum == 0) {
+                ratio = walked == 0 ? 1.0 : std::numeric_limits<double>::infinity();
+            } else {
+                ratio = static_cast<double>(walked) / static_cast<double>(*optimum);
+            }
+        }
+        return {walked, optimum, ratio};
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    struct EvaluationTask {
+        const IGraph<vertex_t, edge_props_t>* graph;
+        const RoundRecord<vertex_t>* round;
+    };
+
+    /**
+     * @brief Evaluates rounds (possibly played on different graphs) in parallel
+     * @return evaluations in the order of tasks
+     */
+    template<typename vertex_t, typename edge_props_t>
+    std::vector<RoundEvaluation<distance_t<edge_props_t>>>
+    evaluateRounds(std::span<const EvaluationTask<vertex_t, edge_props_t>> tasks,
+                   std::size_t threads = std::thread::hardware_concurrency()) {
+        std::vector<RoundEvaluation<distance_t<edge_props_t>>> res(tasks.size());
+        parallelFor(tasks.size(), threads, [&](std::size_t i) {
+            res[i] = evaluateRound(*tasks[i].graph, *tasks[i].round);
+        });
+        return res;
+    }
+
+    template<typename dist_t>
+    RatioSummary summarize(std::span<const RoundEvaluation<dist_t>> evaluations) {
+        std::vector<double> ratios;
+        ratios.reserve(evaluations.size());
+        for (const auto& evaluation : evaluations) {
+            ratios.push_back(evaluation.ratio);
+        }
+        return RatioSummary::of(ratios);
+    }
+}
@@ -1,15 +1,42 @@
 #pragma once
 
+#include <ctpl/game/common.h>
 #include <ctpl/game/ITraveller.h>
 #include <ctpl/game/IAdversary.h>
 #include <ctpl/game/IBanValidator.h>
 #include <ctpl/game/IStepValidator.h>
+#include <ctpl/game/RoundTrace.h>
+#include <ctpl/util/Generator.h>
+#include <format>
+#include <limits>
 #include <memory>
 
 namespace ctpl::game {
+    template<typename vertex_t>
+    struct RoundEvent {
+        enum class Type {
+            // traveller moved along (u, v)
+            STEP,
+            // traveller asked for (u, v), step validator rejected it
+            REJECTED_STEP,
+            // edge (u, v) has been banned
+            BAN,
+            // traveller reached the target at v
+            FINISHED,
+            // step cap is exhausted, traveller is at v
+            STEP_LIMIT
+        };
+
+        Type type;
+        vertex_t u;
+        vertex_t v;
+    };
+
     template<typename vertex_t>
     class Round {
     public:
+        static constexpr std::size_t NO_STEP_LIMIT = std::numeric_limits<std::size_t>::max();
+
         Round(vertex_t source_vertex, vertex_t target_vertex, ITraveller<vertex_t> &traveller,
               IAdversary<vertex_t> &adversary, IBanValidator<vertex_t> &ban_validator,
               IStepValidator<vertex_t> &step_validator)
@@ -17,21 +44,97 @@ namespace ctpl::game {
                   adversary_(adversary), ban_validator_(ban_validator), step_validator_(step_validator) {
         }
 
-        std::vector<vertex_t> run() {
-            std::vector<vertex_t> traveller_path = {source_vertex_};
-            while (traveller_path.back() != target_vertex_) {
-                auto current_vertex = traveller_path.back();
-                auto next_vertex = traveller_.makeStep(traveller_path.back());
+        /**
+         * @brief Plays the round step by step: the traveller and the adversary are called only when the consumer
+         * asks for the next event, so many rounds can be interleaved on one thread.
+         * The round (and its participants) must outlive the generator
+         * @param max_steps cap on makeStep calls (rejected steps included), STEP_LIMIT is the last event
+         * when it's exhausted
+         */
+        Generator<RoundEvent<vertex_t>> events(std::size_t max_steps = NO_STEP_LIMIT) {
+            using Type = RoundEvent<vertex_t>::Type;
+            vertex_t current_vertex = source_vertex_;
+            for (std::size_t steps = 0; current_vertex != target_vertex_; steps++) {
+                if (steps == max_steps) {
+                    co_yield {Type::STEP_LIMIT, current_vertex, current_vertex};
+                    co_return;
+                }
+                auto next_vertex = traveller_.makeStep(current_vertex);
                 if (!step_validator_.validateStep(current_vertex, next_vertex)) {
+                    co_yield {Type::REJECTED_STEP, current_vertex, next_vertex};
                     continue;
                 }
-                traveller_path.push_back(next_vertex);
+                co_yield {Type::STEP, current_vertex, next_vertex};
+
+                std::size_t logged = ban_validator_.banLog().size();
                 adversary_.notifyTravellerStep(current_vertex, next_vertex);
+                for (std::size_t i = logged; i < ban_validator_.banLog().size(); i++) {
+                    if (auto request = ban_validator_.banLog()[i]; request.accepted) {
+                        co_yield {Type::BAN, request.u, request.v};
+                    }
+                }
+                current_vertex = next_vertex;
+            }
+            co_yield {Type::FINISHED, current_vertex, current_vertex};
+        }
+
+        /**
+         * @return traveller path from the source to the target
+         * @throws RoundStepLimitException if the traveller hasn't reached the target in max_steps steps
+         */
+        std::vector<vertex_t> run(std::size_t max_steps = NO_STEP_LIMIT) {
+            std::vector<vertex_t> traveller_path = {source_vertex_};
+            for (const auto &event : events(max_steps)) {
+                if (event.type == RoundEvent<vertex_t>::Type::STEP) {
+                    traveller_path.push_back(event.v);
+                } else if (event.type == RoundEvent<vertex_t>::Type::STEP_LIMIT) {
+                    throw RoundStepLimitException(
+                            std::format("traveller hasn't reached the target in {} steps", max_steps));
+                }
             }
 
             return traveller_path;
         }
 
+        /**
+         * @brief Plays the round and records it, rejected ban requests included
+         * @param graph_id, seed identify the instance for the replay, they are stored as is
+         */
+        RoundTrace<vertex_t> record(std::uint64_t graph_id, std::uint64_t seed, std::size_t max_steps = NO_STEP_LIMIT) {
+            using Type = RoundEvent<vertex_t>::Type;
+            using RecordType = TraceRecord<vertex_t>::Type;
+            RoundTrace<vertex_t> trace{graph_id, seed, source_vertex_, target_vertex_};
+            // ban requests are taken from the log, events report only the accepted ones
+            std::size_t logged = ban_validator_.banLog().size();
+            auto flush_bans = [&]() {
+                for (; logged < ban_validator_.banLog().size(); logged++) {
+                    const auto &request = ban_validator_.banLog()[logged];
+                    trace.records.push_back({request.accepted ? RecordType::BAN : RecordType::REJECTED_BAN,
+                                             request.u, request.v});
+                }
+            };
+            for (const auto &event : events(max_steps)) {
+                flush_bans();
+                switch (event.type) {
+                    case Type::STEP:
+                        trace.records.push_back({RecordType::STEP, event.u, event.v});
+                        break;
+                    case Type::REJECTED_STEP:
+                        trace.records.push_back({RecordType::REJECTED_STEP, event.u, event.v});
+                        break;
+                    case Type::BAN:
+                        break;
+                    case Type::FINISHED:
+                        trace.records.push_back({RecordType::FINISHED, event.u, event.v});
+                        break;
+                    case Type::STEP_LIMIT:
+                        trace.records.push_back({RecordType::STEP_LIMIT, event.u, event.v});
+                        break;
+                }
+            }
+            return trace;
+        }
+
 
     private:
         vertex_t source_vertex_;
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <ctpl/game/Round.h>
+#include <ctpl/game/RoundTrace.h>
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace ctpl::game {
+    template<typename vertex_t>
+    struct ReplayResult {
+        // trace of the replayed round
+        RoundTrace<vertex_t> trace;
+        // index of the first record which differs from the original trace, std::nullopt if the traces are equal
+        std::optional<std::size_t> first_mismatch;
+        // time spent in the round, i.e. in the validators, the stubs are negligible
+        std::chrono::nanoseconds elapsed;
+
+        [[nodiscard]]
+        bool matches() const noexcept {
+            return !first_mismatch;
+        }
+    };
+
+    /**
+     * @brief Replays a recorded round with native stubs of the traveller and the adversary repeating the trace,
+     * so only the graph side (validators) is exercised. Validators are created by the caller over
+     * the graph of the recorded instance, the ban validator must be bound to traveller():
+     * @code
+     * RoundReplay replay(trace);
+     * KBanValidator ban_validator(replay.traveller(), graph, k);
+     * auto result = replay.run(ban_validator, step_validator);
+     * @endcode
+     */
+    template<typename vertex_t>
+    class RoundReplay {
+        using Type = TraceRecord<vertex_t>::Type;
+
+        class ReplayTraveller : public ITraveller<vertex_t> {
+        public:
+            explicit ReplayTraveller(std::vector<vertex_t> steps) : steps_(std::move(steps)) {
+            }
+
+            // out of recorded steps once the replay diverges, stays in place then
+            vertex_t makeStep(vertex_t current_vertex) override {
+                return next_ < steps_.size() ? steps_[next_++] : current_vertex;
+            }
+
+        private:
+            std::vector<vertex_t> steps_;
+            std::size_t next_ = 0;
+        };
+
+        class ReplayAdversary : public IAdversary<vertex_t> {
+            using super = IAdversary<vertex_t>;
+        public:
+            ReplayAdversary(IBanValidator<vertex_t> &validator, const std::vector<std::vector<std::pair<vertex_t, vertex_t>>> &bans)
+                    : super(validator), bans_(bans) {
+            }
+
+            void notifyTravellerStep(vertex_t, vertex_t) override {
+                if (step_ < bans_.size()) {
+                    super::tryBanEdges(bans_[step_]);
+                }
+                ++step_;
+            }
+
+        private:
+            const std::vector<std::vector<std::pair<vertex_t, vertex_t>>> &bans_;
+            std::size_t step_ = 0;
+        };
+
+    public:
+        explicit RoundReplay(RoundTrace<vertex_t> trace) : trace_(std::move(trace)), traveller_(recordedSteps(trace_)) {
+            for (const auto &record : trace_.records) {
+                if (record.type == Type::STEP) {
+                    bans_.emplace_back();
+                } else if ((record.type == Type::BAN || record.type == Type::REJECTED_BAN) && !bans_.empty()) {
+                    bans_.back().push_back({record.u, record.v});
+                }
+            }
+        }
+
+        /**
+         * @brief Traveller stub repeating the recorded steps, rejected ones included
+         */
+        [[nodiscard]]
+        ITraveller<vertex_t> &traveller() noexcept {
+            return traveller_;
+        }
+
+        /**
+         * @brief Plays the round once, the replay can't be reused
+         */
+        ReplayResult<vertex_t> run(IBanValidator<vertex_t> &ban_validator, IStepValidator<vertex_t> &step_validator) {
+            ReplayAdversary adversary(ban_validator, bans_);
+            Round<vertex_t> round(trace_.source, trace_.target, traveller_, adversary, ban_validator, step_validator);
+
+            auto start = std::chrono::steady_clock::now();
+            auto trace = round.record(trace_.graph_id, trace_.seed, stepAttempts());
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            std::optional<std::size_t> first_mismatch;
+            auto [replayed, original] = std::mismatch(trace.records.begin(), trace.records.end(),
+                                                      trace_.records.begin(), trace_.records.end());
+            if (replayed != trace.records.end() || original != trace_.records.end()) {
+                first_mismatch = replayed - trace.records.begin();
+            }
+            return {std::move(trace), first_mismatch, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)};
+        }
+
+    private:
+        static std::vector<vertex_t> recordedSteps(const RoundTrace<vertex_t> &trace) {
+            std::vector<vertex_t> steps;
+            for (const auto &record : trace.records) {
+                if (record.type == Type::STEP || record.type == Type::REJECTED_STEP) {
+                    steps.push_back(record.v);
+                }
+            }
+            return steps;
+        }
+
+        // the original step cap if it was hit, otherwise the replay can't take more steps than recorded
+        std::size_t stepAttempts() const {
+            std::size_t attempts = recordedSteps(trace_).size();
+            if (trace_.records.empty() || trace_.records.back().type != Type::STEP_LIMIT) {
+                ++attempts;
+            }
+            return attempts;
+        }
+
+        RoundTrace<vertex_t> trace_;
+        ReplayTraveller traveller_;
+        std::vector<std::vector<std::pair<vertex_t, vertex_t>>> bans_{};
+    };
+}
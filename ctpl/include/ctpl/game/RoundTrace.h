@@ -0,0 +1,176 @@
+#pragma once
+
+#include <ctpl/game/common.h>
+#include <ctpl/util/varint.h>
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ctpl::game {
+    template<typename vertex_t>
+    struct TraceRecord {
+        enum class Type : std::uint8_t {
+            // traveller moved along (u, v)
+            STEP,
+            // traveller asked for (u, v), step validator rejected it
+            REJECTED_STEP,
+            // ban of (u, v) has been requested and accepted
+            BAN,
+            // ban of (u, v) has been requested and rejected
+            REJECTED_BAN,
+            // traveller reached the target at u = v
+            FINISHED,
+            // step cap is exhausted, traveller is at u = v
+            STEP_LIMIT
+        };
+
+        Type type;
+        vertex_t u;
+        vertex_t v;
+
+        bool operator==(const TraceRecord&) const = default;
+    };
+
+    /**
+     * @brief Everything that happened in a round, enough to replay it without the original participants.
+     * Binary form: magic, version byte, then varints: graph id, seed, source, target, record count and
+     * the records. A record is its type byte followed by v for steps, by u and v for bans and by nothing
+     * for the final record, the rest is implied by the traveller position
+     */
+    template<std::integral vertex_t>
+    struct RoundTrace {
+        static constexpr std::string_view MAGIC = "CTPT";
+        static constexpr std::uint8_t VERSION = 1;
+        using Type = TraceRecord<vertex_t>::Type;
+
+        std::uint64_t graph_id = 0;
+        std::uint64_t seed = 0;
+        vertex_t source{};
+        vertex_t target{};
+        std::vector<TraceRecord<vertex_t>> records{};
+
+        bool operator==(const RoundTrace&) const = default;
+
+        [[nodiscard]]
+        std::string encode() const {
+            std::string res(MAGIC);
+            res.push_back(static_cast<char>(VERSION));
+            putVarint(res, graph_id);
+            putVarint(res, seed);
+            putVertex(res, source);
+            putVertex(res, target);
+            putVarint(res, records.size());
+            for (const auto& record : records) {
+                res.push_back(static_cast<char>(record.type));
+                switch (record.type) {
+                    case Type::BAN:
+                    case Type::REJECTED_BAN:
+                        putVertex(res, record.u);
+                        [[fallthrough]];
+                    case Type::STEP:
+                    case Type::REJECTED_STEP:
+                        putVertex(res, record.v);
+                        break;
+                    case Type::FINISHED:
+                    case Type::STEP_LIMIT:
+                        break;
+                }
+            }
+            return res;
+        }
+
+        /**
+         * @throws TraceFormatException if data isn't a trace encoded by encode()
+         */
+        static RoundTrace decode(std::string_view data) {
+            if (!data.starts_with(MAGIC) || data.size() <= MAGIC.size() ||
+                static_cast<std::uint8_t>(data[MAGIC.size()]) != VERSION) {
+                throw TraceFormatException("not a round trace or unsupported version");
+            }
+            std::size_t pos = MAGIC.size() + 1;
+            RoundTrace trace;
+            trace.graph_id = getVarint(data, pos);
+            trace.seed = getVarint(data, pos);
+            trace.source = getVertex(data, pos);
+            trace.target = getVertex(data, pos);
+            std::uint64_t count = getVarint(data, pos);
+            if (count > data.size() - pos) {
+                throw TraceFormatException("record count exceeds the trace size");
+            }
+
+            vertex_t current = trace.source;
+            trace.records.reserve(count);
+            for (std::uint64_t i = 0; i < count; i++) {
+                if (pos == data.size()) {
+                    throw TraceFormatException("trace is truncated");
+                }
+                auto type = static_cast<Type>(data[pos++]);
+                switch (type) {
+                    case Type::STEP:
+                    case Type::REJECTED_STEP: {
+                        vertex_t v = getVertex(data, pos);
+                        trace.records.push_back({type, current, v});
+                        if (type == Type::STEP) {
+                            current = v;
+                        }
+                        break;
+                    }
+                    case Type::BAN:
+                    case Type::REJECTED_BAN: {
+                        vertex_t u = getVertex(data, pos);
+                        trace.records.push_back({type, u, getVertex(data, pos)});
+                        break;
+                    }
+                    case Type::FINISHED:
+                    case Type::STEP_LIMIT:
+                        trace.records.push_back({type, current, current});
+                        break;
+                    default:
+                        throw TraceFormatException("unknown record type");
+                }
+            }
+            if (pos != data.size()) {
+                throw TraceFormatException("trailing bytes after the last record");
+            }
+            return trace;
+        }
+
+    private:
+        static std::uint64_t getVarint(std::string_view data, std::size_t& pos) {
+            if (auto x = ::ctpl::getVarint(data, pos)) {
+                return *x;
+            }
+            throw TraceFormatException("trace is truncated or has a malformed varint");
+        }
+
+        // signed vertices are zigzag encoded, so small negative values stay short
+        static void putVertex(std::string& out, vertex_t u) {
+            if constexpr (std::is_signed_v<vertex_t>) {
+                putVarint(out, zigzagEncode(u));
+            } else {
+                putVarint(out, u);
+            }
+        }
+
+        // a foreign or corrupt trace may hold ids wider than vertex_t, they are rejected instead of truncated
+        static vertex_t getVertex(std::string_view data, std::size_t& pos) {
+            std::uint64_t x = getVarint(data, pos);
+            if constexpr (std::is_signed_v<vertex_t>) {
+                std::int64_t u = zigzagDecode(x);
+                if (!std::in_range<vertex_t>(u)) {
+                    throw TraceFormatException("vertex is out of the vertex type range");
+                }
+                return static_cast<vertex_t>(u);
+            } else {
+                if (!std::in_range<vertex_t>(x)) {
+                    throw TraceFormatException("vertex is out of the vertex type range");
+                }
+                return static_cast<vertex_t>(x);
+            }
+        }
+    };
+}
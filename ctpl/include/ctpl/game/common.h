@@ -13,4 +13,22 @@ namespace ctpl::game {
     public:
         using super::super;
     };
+
+    class RoundStepLimitException : public std::runtime_error {
+        using super = std::runtime_error;
+    public:
+        using super::super;
+    };
+
+    class RoundEvaluationException : public std::runtime_error {
+        using super = std::runtime_error;
+    public:
+        using super::super;
+    };
+
+    class TraceFormatException : public std::runtime_error {
+        using super = std::runtime_error;
+    public:
+        using super::super;
+    };
 }
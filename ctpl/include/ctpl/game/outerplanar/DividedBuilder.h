@@ -2,6 +2,7 @@
 
 #include <ctpl/graph/DynamicGraph.h>
 #include <ctpl/graph/Builder.h>
+#include <ctpl/graph/Reorder.h>
 
 namespace ctpl::game {
     using default_vertex_t = std::uint32_t;
@@ -33,6 +34,20 @@ namespace ctpl::game {
             return withSideB(cont.begin(), cont.end());
         }
 
+        /**
+         * @brief Marks the input as valid by construction (e.g. produced by generateDividedOuterplanar),
+         * DividedOuterplanarGraph skips the side and outerplanarity checks for trusted builders
+         */
+        DividedOuterplanarBuilder& withTrusted(bool trusted = true) {
+            trusted_ = trusted;
+            return *this;
+        }
+
+        [[nodiscard]]
+        bool isTrusted() const noexcept {
+            return trusted_;
+        }
+
         [[nodiscard]]
         const std::vector<default_vertex_t>& sideA() const noexcept {
             return side_a_;
@@ -46,5 +61,18 @@ namespace ctpl::game {
     private:
         std::vector<default_vertex_t> side_a_;
         std::vector<default_vertex_t> side_b_;
+        bool trusted_ = false;
     };
+
+    /**
+     * @brief Order along the outer face: side A from the source to the target, then side B back to the source,
+     * so vertices close on the face get close ids. Vertices on neither side are placed last
+     */
+    Permutation<default_vertex_t> outerFaceOrder(const DividedOuterplanarBuilder& builder);
+
+    /**
+     * @brief Copy of the builder with renamed vertices, the sides are renamed as well and the trust mark is kept
+     */
+    DividedOuterplanarBuilder reordered(const DividedOuterplanarBuilder& builder,
+                                        const Permutation<default_vertex_t>& permutation);
 }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <ctpl/game/outerplanar/DividedBuilder.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace ctpl::game {
+    struct DividedOuterplanarGeneratorOptions {
+        // total number of vertices, at least 3
+        std::size_t vertex_count = 16;
+        // probability that a chord is placed at a step of the chord walk, the expected chord count is
+        // about chord_density * (vertex_count - 2)
+        double chord_density = 0.5;
+        weight_t min_weight = 1;
+        weight_t max_weight = 100;
+        std::uint64_t seed = 0;
+    };
+
+    /**
+     * @brief Generates a random divided outerplanar graph, valid by construction: vertex 0 is the source,
+     * side A is 0, 1, ..., p, p + 1, side B is 0, p + 2, ..., n - 1, p + 1 (p is random),
+     * both sides are paths, and chords connect interior vertices of different sides without crossings.
+     * The result depends only on the options, it is marked trusted so building the graph skips validation.
+     * Runs in O(vertex_count)
+     */
+    DividedOuterplanarBuilder generateDividedOuterplanar(const DividedOuterplanarGeneratorOptions& options);
+
+    /**
+     * @brief Generates count instances in parallel, the i-th instance is generated with a seed derived
+     * from options.seed and i, so the result doesn't depend on threads
+     */
+    std::vector<DividedOuterplanarBuilder> generateDividedOuterplanarMany(
+            const DividedOuterplanarGeneratorOptions& options, std::size_t count,
+            std::size_t threads = std::thread::hardware_concurrency());
+}
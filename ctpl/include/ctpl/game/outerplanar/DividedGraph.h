@@ -5,8 +5,36 @@
 #include <ctpl/game/outerplanar/DividedBuilder.h>
 #include <ctpl/graph/DynamicGraph.h>
 #include <ctpl/graph/Builder.h>
+#include <ctpl/util/SegmentTree.h>
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <set>
+#include <span>
+#include <unordered_map>
 
 namespace ctpl::game {
+    enum class Side {
+        A,
+        B
+    };
+
+    struct SidePosition {
+        Side side;
+        // index in sideA() or sideB()
+        std::size_t index;
+    };
+
+    /**
+     * @brief Edge between an interior vertex of side A and an interior vertex of side B
+     */
+    struct Chord {
+        default_vertex_t a;
+        default_vertex_t b;
+        std::size_t a_index;
+        std::size_t b_index;
+    };
+
     class DividedOuterplanarGraph : public DynamicGraph<default_vertex_t, outerplanar_props_t> {
         using super = DynamicGraph<default_vertex_t, outerplanar_props_t>;
     public:
@@ -15,8 +43,82 @@ namespace ctpl::game {
             explicit BuildException(const std::string& reason);
         };
 
+        class InvalidEdgeException : public std::runtime_error {
+        public:
+            explicit InvalidEdgeException(const std::string& reason);
+        };
+
         DividedOuterplanarGraph(const DividedOuterplanarBuilder& builder); // NOLINT
 
+        /**
+         * @brief Adds the edge if it keeps the graph outerplanar with the outer face bounded by the sides:
+         * both endpoints are on the sides and the edge crosses no existing chord. O(log n)
+         * @throws InvalidEdgeException otherwise
+         */
+        void addEdge(vertex u, vertex v, outerplanar_props_t props) override;
+
+        /**
+         * @brief Same as addEdge, but reports an invalid edge instead of throwing
+         * @return whether the edge has been added
+         */
+        bool tryAddEdge(vertex u, vertex v, outerplanar_props_t props);
+
+        /**
+         * @return whether addEdge(u, v, ...) would be accepted, O(log n)
+         */
+        [[nodiscard]]
+        bool canAddEdge(vertex u, vertex v) const;
+
+        void removeEdge(vertex u, vertex v) override;
+
+        /**
+         * @brief Checks every ADD upfront, then applies the batch to the adjacency lists and refreshes the position
+         * and the chord indices once per touched vertex and edge. An ADD is checked against the graph before
+         * the batch and the previous ADDs of the batch, so it can't rely on a removal from the same batch
+         * @throws InvalidEdgeException if an ADD is rejected, the graph is left unchanged
+         */
+        void applyMutations(std::span<const Mutation<vertex, outerplanar_props_t>> mutations) override;
+
+        /**
+         * @return side and index of the vertex, the source and the target are reported on side A. O(1)
+         */
+        [[nodiscard]]
+        std::optional<SidePosition> sidePosition(vertex u) const;
+
+        /**
+         * @return whether (u, v) is an edge between interior vertices of different sides
+         */
+        [[nodiscard]]
+        bool isChord(vertex u, vertex v) const;
+
+        /**
+         * @return all chords ordered by side A index (then by side B index)
+         */
+        [[nodiscard]]
+        std::vector<Chord> chords() const;
+
+        /**
+         * @return the first chord with an endpoint on the side after index (ties are broken by the other side), O(log n)
+         */
+        [[nodiscard]]
+        std::optional<Chord> nextChord(Side side, std::size_t index) const;
+
+        /**
+         * @return chords with an endpoint on the side at an index in [from, to), ordered by that index.
+         * O(log n + answer)
+         */
+        [[nodiscard]]
+        std::vector<Chord> chordsInRange(Side side, std::size_t from, std::size_t to) const;
+
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            return super::memoryUsage()
+                    .add("sides", vectorMemory(side_a_) + vectorMemory(side_b_))
+                    .add("position index", hashBucketsMemory(cycle_position_) + hashNodesMemory(cycle_position_) +
+                                           2 * partner_ranges_.size() * sizeof(PartnerRange))
+                    .add("chord index", 2 * chords_by_a_.size() * (sizeof(chord_key_t) + 4 * sizeof(void*)));
+        }
+
         [[nodiscard]]
         const std::vector<default_vertex_t>& sideA() const noexcept {
             return side_a_;
@@ -28,7 +130,40 @@ namespace ctpl::game {
         }
 
     private:
+        // positions on the outer cycle (side A, then side B reversed) of the nearest and the farthest neighbours
+        struct PartnerRange {
+            std::size_t min = std::numeric_limits<std::size_t>::max();
+            std::size_t max = 0;
+        };
+
+        struct PartnerRangeCombine {
+            PartnerRange operator()(const PartnerRange& lhs, const PartnerRange& rhs) const noexcept {
+                return {std::min(lhs.min, rhs.min), std::max(lhs.max, rhs.max)};
+            }
+        };
+
+        void validate(const DividedOuterplanarBuilder& builder) const;
+
+        void buildPositionIndex();
+
+        void refreshPartnerRange(vertex u);
+
+        // (index on the own side, index on the other side)
+        using chord_key_t = std::pair<std::size_t, std::size_t>;
+
+        void updateChordIndex(vertex u, vertex v, bool present);
+
+        Chord chordAt(Side side, const chord_key_t& key) const;
+
+        const std::set<chord_key_t>& chordsBy(Side side) const noexcept {
+            return side == Side::A ? chords_by_a_ : chords_by_b_;
+        }
+
         std::vector<default_vertex_t> side_a_;
         std::vector<default_vertex_t> side_b_;
+        std::unordered_map<vertex, std::size_t> cycle_position_{};
+        SegmentTree<PartnerRange, PartnerRangeCombine> partner_ranges_{0, {}};
+        std::set<chord_key_t> chords_by_a_{};
+        std::set<chord_key_t> chords_by_b_{};
     };
 }
@@ -36,6 +36,14 @@ namespace ctpl {
             return *static_cast<self*>(this);
         }
 
+        /**
+         * @brief Preallocates room for count edges, useful when the edge count is known upfront
+         */
+        self& reserveEdges(std::size_t count) {
+            edges_.reserve(count);
+            return *static_cast<self*>(this);
+        }
+
         template<typename Iterator>
         self& withEdges(Iterator begin, Iterator end) {
             std::for_each(begin, end, [this](const edge& e) {
@@ -59,6 +67,21 @@ namespace ctpl {
             return vertex_count_;
         }
 
+        /**
+         * @return the vertex count if it's set, otherwise the largest edge endpoint plus one
+         */
+        [[nodiscard]]
+        std::size_t deducedVertexCount() const {
+            if (vertex_count_ != UNKNOWN_VERTEX_COUNT) {
+                return vertex_count_;
+            }
+            std::size_t vertex_count = 0;
+            for (const edge& e : edges_) {
+                vertex_count = std::max<std::size_t>({vertex_count, e.u + std::size_t{1}, e.v + std::size_t{1}});
+            }
+            return vertex_count;
+        }
+
     private:
         std::size_t vertex_count_ = UNKNOWN_VERTEX_COUNT;
         std::vector<edge> edges_{};
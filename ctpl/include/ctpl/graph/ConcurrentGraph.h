@@ -0,0 +1,308 @@
+#pragma once
+
+#include <ctpl/graph/IDynamicGraph.h>
+#include <ctpl/graph/Builder.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/epoch.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Thread-safe graph on vertices [0, n) for read-mostly workloads: every adjacency list is an immutable
+     * sorted array published through an atomic pointer. Readers never lock and always see a consistent snapshot
+     * of a single adjacency list; writers are serialized, copy the list, publish the copy and retire the old one
+     * through EpochDomain. Mutations are O(degree), an undirected mutation publishes both lists one after another,
+     * visitAllEdges doesn't take a global snapshot
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class ConcurrentGraph : public IDynamicGraph<vertex_t, edge_props_t> {
+        using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
+        using entry_t = AdjacentVertex<vertex_t, edge_props_t>;
+        template<typename builder_self_t>
+        using Builder = GraphBuilder<vertex_t, edge_props_t, builder_self_t>;
+
+        struct AdjList {
+            // sorted by v
+            std::vector<entry_t> entries;
+        };
+    public:
+        explicit ConcurrentGraph(std::size_t vertex_count) : lists_(vertex_count) {
+        }
+
+        /**
+         * @brief Vertices are expected to be numbered from 0, if vertex count isn't set, it's deduced from the edges
+         */
+        template<typename builder_self_t>
+        ConcurrentGraph(const Builder<builder_self_t>& builder) : ConcurrentGraph(builder.deducedVertexCount()) { // NOLINT
+            std::vector<std::vector<entry_t>> adj(lists_.size());
+            auto insert = [&](vertex_t u, vertex_t v, const edge_props_t& props) {
+                checkVertexRange(u, v);
+                adj[u].emplace_back(v, props);
+            };
+            for (const Edge<vertex_t, edge_props_t>& e : builder.edges()) {
+                insert(e.u, e.v, e);
+                if constexpr (has_prop<Undirected, edge_props_t>) {
+                    insert(e.v, e.u, e);
+                }
+            }
+            for (std::size_t u = 0; u < adj.size(); u++) {
+                // stable sort and keeping the last duplicate matches addEdge overwriting props
+                std::stable_sort(adj[u].begin(), adj[u].end(), [](const entry_t& lhs, const entry_t& rhs) {
+                    return lhs.v < rhs.v;
+                });
+                std::vector<entry_t> unique;
+                unique.reserve(adj[u].size());
+                for (const entry_t& entry : adj[u]) {
+                    if (!unique.empty() && unique.back().v == entry.v) {
+                        unique.back() = entry;
+                    } else {
+                        unique.push_back(entry);
+                    }
+                }
+                if (!unique.empty()) {
+                    lists_[u].store(new AdjList{std::move(unique)}, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        ConcurrentGraph(const ConcurrentGraph&) = delete;
+        ConcurrentGraph& operator=(const ConcurrentGraph&) = delete;
+
+        ~ConcurrentGraph() override {
+            for (auto& list : lists_) {
+                delete list.load(std::memory_order_relaxed);
+            }
+        }
+
+        bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
+            auto guard = epoch_.enter();
+            return find(load(u), v) != nullptr;
+        }
+
+        std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
+            auto guard = epoch_.enter();
+            if (const entry_t* entry = find(load(u), v)) {
+                return entry->props();
+            }
+            return std::nullopt;
+        }
+
+        void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
+            auto guard = epoch_.enter();
+            if (const AdjList* list = load(vertex)) {
+                for (const entry_t& entry : list->entries) {
+                    visitor(vertex, entry.v, entry.props());
+                }
+            }
+        }
+
+        void visitAllEdges(const Visitor& visitor) const override {
+            for (std::size_t u = 0; u < lists_.size(); u++) {
+                auto guard = epoch_.enter();
+                const AdjList* list = lists_[u].load(std::memory_order_acquire);
+                if (list == nullptr) {
+                    continue;
+                }
+                auto vertex = static_cast<vertex_t>(u);
+                for (const entry_t& entry : list->entries) {
+                    if constexpr (has_prop<Undirected, edge_props_t>) {
+                        if (entry.v < vertex) {
+                            continue;
+                        }
+                    }
+                    visitor(vertex, entry.v, entry.props());
+                }
+            }
+        }
+
+        /**
+         * @throws std::out_of_range if an endpoint isn't a vertex of the graph
+         */
+        void addEdge(vertex_t u, vertex_t v, edge_props_t props) override {
+            checkVertexRange(u, v);
+            std::lock_guard lock(writer_mutex_);
+            publish(u, [&](std::vector<entry_t>& entries) {
+                insertSorted(entries, v, props);
+                return true;
+            });
+            if constexpr (has_prop<Undirected, edge_props_t>) {
+                publish(v, [&](std::vector<entry_t>& entries) {
+                    insertSorted(entries, u, props);
+                    return true;
+                });
+            }
+        }
+
+        void removeEdge(vertex_t u, vertex_t v) override {
+            if (!isVertexInRange(u) || !isVertexInRange(v)) {
+                return;
+            }
+            std::lock_guard lock(writer_mutex_);
+            publish(u, [&](std::vector<entry_t>& entries) {
+                return eraseSorted(entries, v);
+            });
+            if constexpr (has_prop<Undirected, edge_props_t>) {
+                publish(v, [&](std::vector<entry_t>& entries) {
+                    return eraseSorted(entries, u);
+                });
+            }
+        }
+
+        /**
+         * @brief Every touched adjacency list is copied and published once per batch instead of once per mutation
+         * @throws std::out_of_range if an ADD has an endpoint that isn't a vertex of the graph, nothing is applied
+         */
+        void applyMutations(std::span<const Mutation<vertex_t, edge_props_t>> mutations) override {
+            using Type = Mutation<vertex_t, edge_props_t>::Type;
+            // (list owner, mutation index), sorted so mutations of a list stay in order
+            std::vector<std::pair<vertex_t, std::size_t>> touched;
+            touched.reserve(2 * mutations.size());
+            for (std::size_t i = 0; i < mutations.size(); i++) {
+                const auto& m = mutations[i];
+                if (m.type == Type::ADD) {
+                    checkVertexRange(m.u, m.v);
+                } else if (!isVertexInRange(m.u) || !isVertexInRange(m.v)) {
+                    continue;
+                }
+                touched.emplace_back(m.u, i);
+                if constexpr (has_prop<Undirected, edge_props_t>) {
+                    touched.emplace_back(m.v, i);
+                }
+            }
+            std::sort(touched.begin(), touched.end());
+
+            std::lock_guard lock(writer_mutex_);
+            for (std::size_t begin = 0, end = 0; begin < touched.size(); begin = end) {
+                vertex_t u = touched[begin].first;
+                while (end < touched.size() && touched[end].first == u) {
+                    ++end;
+                }
+                publish(u, [&](std::vector<entry_t>& entries) {
+                    bool changed = false;
+                    for (std::size_t i = begin; i < end; i++) {
+                        const auto& m = mutations[touched[i].second];
+                        vertex_t v = m.u == u ? m.v : m.u;
+                        if (m.type == Type::ADD) {
+                            insertSorted(entries, v, m.props);
+                            changed = true;
+                        } else {
+                            changed |= eraseSorted(entries, v);
+                        }
+                    }
+                    return changed;
+                });
+            }
+        }
+
+        /**
+         * @brief Frees retired adjacency lists, waiting for readers that may still use them
+         */
+        void compact() override {
+            reclaim();
+        }
+
+        /**
+         * @brief Not synchronized with writers, lists retired but not yet reclaimed aren't counted
+         */
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            MemoryUsage res;
+            res.add("list pointers", vectorMemory(lists_));
+            auto guard = epoch_.enter();
+            for (const auto& list : lists_) {
+                if (const AdjList* adj = list.load(std::memory_order_acquire)) {
+                    res.add("adjacency entries", sizeof(AdjList) + vectorMemory(adj->entries));
+                }
+            }
+            return res;
+        }
+
+        [[nodiscard]]
+        std::size_t vertexCount() const noexcept {
+            return lists_.size();
+        }
+
+        /**
+         * @brief Waits for readers and frees every retired adjacency list, normally it happens in batches
+         */
+        void reclaim() {
+            std::lock_guard lock(writer_mutex_);
+            epoch_.barrier();
+        }
+
+    private:
+        bool isVertexInRange(vertex_t u) const noexcept {
+            return 0 <= u && static_cast<std::size_t>(u) < lists_.size();
+        }
+
+        void checkVertexRange(vertex_t u, vertex_t v) const {
+            if (!isVertexInRange(u) || !isVertexInRange(v)) {
+                throw std::out_of_range("vertex number is out of range");
+            }
+        }
+
+        const AdjList* load(vertex_t u) const noexcept {
+            return isVertexInRange(u) ? lists_[u].load(std::memory_order_acquire) : nullptr;
+        }
+
+        static const entry_t* find(const AdjList* list, vertex_t v) noexcept {
+            if (list == nullptr) {
+                return nullptr;
+            }
+            auto it = std::lower_bound(list->entries.begin(), list->entries.end(), v, [](const entry_t& entry, vertex_t x) {
+                return entry.v < x;
+            });
+            return it != list->entries.end() && it->v == v ? &*it : nullptr;
+        }
+
+        static void insertSorted(std::vector<entry_t>& entries, vertex_t v, const edge_props_t& props) {
+            auto it = std::lower_bound(entries.begin(), entries.end(), v, [](const entry_t& entry, vertex_t x) {
+                return entry.v < x;
+            });
+            if (it != entries.end() && it->v == v) {
+                *it = entry_t(v, props);
+            } else {
+                entries.insert(it, entry_t(v, props));
+            }
+        }
+
+        static bool eraseSorted(std::vector<entry_t>& entries, vertex_t v) {
+            auto it = std::lower_bound(entries.begin(), entries.end(), v, [](const entry_t& entry, vertex_t x) {
+                return entry.v < x;
+            });
+            if (it == entries.end() || it->v != v) {
+                return false;
+            }
+            entries.erase(it);
+            return true;
+        }
+
+        // copies the list of u, applies the modification and publishes the copy if it reports a change
+        template<typename Modify>
+        void publish(vertex_t u, Modify&& modify) {
+            const AdjList* old_list = lists_[u].load(std::memory_order_relaxed);
+            auto new_list = std::make_unique<AdjList>();
+            if (old_list != nullptr) {
+                new_list->entries.reserve(old_list->entries.size() + 1);
+                new_list->entries = old_list->entries;
+            }
+            if (!modify(new_list->entries)) {
+                return;
+            }
+            lists_[u].store(new_list.release(), std::memory_order_release);
+            if (old_list != nullptr) {
+                epoch_.retire(old_list);
+            }
+        }
+
+        std::vector<std::atomic<const AdjList*>> lists_;
+        std::mutex writer_mutex_{};
+        EpochDomain epoch_{};
+    };
+}
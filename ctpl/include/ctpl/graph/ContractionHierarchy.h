@@ -0,0 +1,387 @@
+#pragma once
+
+#include <ctpl/graph/Builder.h>
+#include <ctpl/graph/Reorder.h>
+#include <ctpl/graph/algo.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Customizable contraction hierarchy (CCH) of an undirected graph: the topology is contracted once
+     * in a nested dissection order, weights are customized separately, so changing or banning an edge only
+     * re-customizes the shortcuts depending on it. Queries walk the elimination tree and take time
+     * proportional to the number of ancestors of the endpoints.
+     * Vertices are expected to be numbered from 0 as for IndexedGraph, queries reuse internal buffers,
+     * so a hierarchy must not be queried concurrently
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class CustomizableContractionHierarchy {
+        static_assert(has_prop<Undirected, edge_props_t>, "CCH supports undirected graphs only");
+    public:
+        using dist_t = distance_t<edge_props_t>;
+        static constexpr dist_t INF = std::numeric_limits<dist_t>::max();
+
+    private:
+        static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+        struct DownArc {
+            // lower endpoint rank
+            std::size_t tail;
+            std::size_t arc;
+        };
+
+    public:
+        template<typename self_t>
+        explicit CustomizableContractionHierarchy(const GraphBuilder<vertex_t, edge_props_t, self_t>& builder)
+                : CustomizableContractionHierarchy(builder, vertexOrder(builder, VertexOrder::NESTED_DISSECTION)) {
+        }
+
+        /**
+         * @param order contraction order, order.toNew(u) is the rank of u, vertices are contracted by increasing rank
+         */
+        template<typename self_t>
+        CustomizableContractionHierarchy(const GraphBuilder<vertex_t, edge_props_t, self_t>& builder,
+                                         Permutation<vertex_t> order) : order_(std::move(order)) {
+            std::size_t n = order_.size();
+            std::vector<std::vector<std::size_t>> up(n);
+            for (const auto& e : builder.edges()) {
+                if (e.u != e.v) {
+                    std::size_t a = rank(e.u);
+                    std::size_t b = rank(e.v);
+                    up[std::min(a, b)].push_back(std::max(a, b));
+                }
+            }
+            // contracting x connects its upper neighbours, the lowest of them gets all the others
+            std::vector<std::size_t> merged;
+            for (std::size_t x = 0; x < n; x++) {
+                std::sort(up[x].begin(), up[x].end());
+                up[x].erase(std::unique(up[x].begin(), up[x].end()), up[x].end());
+                if (up[x].size() > 1) {
+                    std::size_t p = up[x].front();
+                    std::sort(up[p].begin(), up[p].end());
+                    merged.clear();
+                    std::set_union(up[p].begin(), up[p].end(), up[x].begin() + 1, up[x].end(),
+                                   std::back_inserter(merged));
+                    up[p].swap(merged);
+                }
+            }
+
+            up_offsets_.assign(n + 1, 0);
+            for (std::size_t x = 0; x < n; x++) {
+                up_offsets_[x + 1] = up_offsets_[x] + up[x].size();
+            }
+            heads_.reserve(up_offsets_.back());
+            tails_.reserve(up_offsets_.back());
+            for (std::size_t x = 0; x < n; x++) {
+                heads_.insert(heads_.end(), up[x].begin(), up[x].end());
+                tails_.insert(tails_.end(), up[x].size(), x);
+                std::vector<std::size_t>().swap(up[x]);
+            }
+
+            down_offsets_.assign(n + 1, 0);
+            for (std::size_t y : heads_) {
+                ++down_offsets_[y + 1];
+            }
+            std::partial_sum(down_offsets_.begin(), down_offsets_.end(), down_offsets_.begin());
+            down_.resize(heads_.size());
+            std::vector<std::size_t> fill(down_offsets_.begin(), down_offsets_.end() - 1);
+            for (std::size_t arc = 0; arc < heads_.size(); arc++) {
+                down_[fill[heads_[arc]]++] = {tails_[arc], arc};
+            }
+
+            input_.assign(heads_.size(), INF);
+            for (const auto& e : builder.edges()) {
+                if (e.u != e.v) {
+                    std::size_t arc = findArc(rank(e.u), rank(e.v));
+                    input_[arc] = std::min(input_[arc], edgeLength<edge_props_t>(e));
+                }
+            }
+            original_ = input_;
+            customize();
+
+            forward_ = {std::vector<dist_t>(n, INF), std::vector<std::size_t>(n, NONE)};
+            backward_ = {std::vector<dist_t>(n, INF), std::vector<std::size_t>(n, NONE)};
+            queued_.assign(heads_.size(), false);
+        }
+
+        [[nodiscard]]
+        std::size_t vertexCount() const noexcept {
+            return order_.size();
+        }
+
+        /**
+         * @return number of arcs of the hierarchy, graph edges and shortcuts
+         */
+        [[nodiscard]]
+        std::size_t arcCount() const noexcept {
+            return heads_.size();
+        }
+
+        [[nodiscard]]
+        const Permutation<vertex_t>& order() const noexcept {
+            return order_;
+        }
+
+        /**
+         * @brief Sets the weight of the edge (all its copies for a multigraph) and re-customizes the shortcuts
+         * depending on it, INF removes the edge from the metric
+         * @return whether the edge is in the graph
+         */
+        bool setWeight(vertex_t u, vertex_t v, dist_t weight) {
+            std::size_t arc = findEdge(u, v);
+            if (arc == NONE) {
+                return false;
+            }
+            input_[arc] = weight;
+            recustomize(arc);
+            return true;
+        }
+
+        /**
+         * @brief Same as setWeight(u, v, INF)
+         */
+        bool banEdge(vertex_t u, vertex_t v) {
+            return setWeight(u, v, INF);
+        }
+
+        /**
+         * @brief Restores the weight the edge had in the builder
+         */
+        bool unbanEdge(vertex_t u, vertex_t v) {
+            std::size_t arc = findEdge(u, v);
+            return arc != NONE && setWeight(u, v, original_[arc]);
+        }
+
+        [[nodiscard]]
+        bool isEdgeBanned(vertex_t u, vertex_t v) const {
+            std::size_t arc = findEdge(u, v);
+            return arc != NONE && input_[arc] == INF;
+        }
+
+        std::optional<dist_t> shortestPathLength(vertex_t s, vertex_t t) {
+            auto [meeting, dist] = query(rank(s), rank(t));
+            resetQuery();
+            if (meeting == NONE) {
+                return std::nullopt;
+            }
+            return dist;
+        }
+
+        /**
+         * @return vertices of a shortest path from s to t, empty if t isn't reachable
+         */
+        std::vector<vertex_t> shortestPath(vertex_t s, vertex_t t) {
+            auto [meeting, dist] = query(rank(s), rank(t));
+            std::vector<vertex_t> res;
+            if (meeting != NONE) {
+                // s -> meeting is unpacked backwards, then meeting -> t forwards
+                std::vector<std::size_t> ranks = {meeting};
+                for (std::size_t x = meeting; forward_.parent[x] != NONE; x = tails_[forward_.parent[x]]) {
+                    unpack(x, tails_[forward_.parent[x]], forward_.parent[x], ranks);
+                }
+                std::reverse(ranks.begin(), ranks.end());
+                for (std::size_t x = meeting; backward_.parent[x] != NONE; x = tails_[backward_.parent[x]]) {
+                    unpack(x, tails_[backward_.parent[x]], backward_.parent[x], ranks);
+                }
+                res.reserve(ranks.size());
+                for (std::size_t x : ranks) {
+                    res.push_back(order_.toOld(static_cast<vertex_t>(x)));
+                }
+            }
+            resetQuery();
+            return res;
+        }
+
+    private:
+        struct Search {
+            std::vector<dist_t> dist;
+            // arc the vertex was reached by
+            std::vector<std::size_t> parent;
+            std::vector<std::size_t> touched{};
+        };
+
+        static dist_t add(dist_t a, dist_t b) noexcept {
+            return a == INF || b == INF ? INF : a + b;
+        }
+
+        std::size_t rank(vertex_t u) const noexcept {
+            CTPL_ASSERT(0 <= u && static_cast<std::size_t>(u) < vertexCount(), "vertex number is out of range");
+            return order_.toNew(u);
+        }
+
+        // arc between ranks x and y or NONE
+        std::size_t findArc(std::size_t x, std::size_t y) const noexcept {
+            if (x > y) {
+                std::swap(x, y);
+            }
+            auto begin = heads_.begin() + up_offsets_[x];
+            auto end = heads_.begin() + up_offsets_[x + 1];
+            auto it = std::lower_bound(begin, end, y);
+            return it != end && *it == y ? it - heads_.begin() : NONE;
+        }
+
+        // arc of a graph edge, shortcuts aren't edges
+        std::size_t findEdge(vertex_t u, vertex_t v) const {
+            if (u == v || !(0 <= u && static_cast<std::size_t>(u) < vertexCount()) ||
+                !(0 <= v && static_cast<std::size_t>(v) < vertexCount())) {
+                return NONE;
+            }
+            std::size_t arc = findArc(rank(u), rank(v));
+            return arc != NONE && original_[arc] != INF ? arc : NONE;
+        }
+
+        // the shortest way over the arc: itself or a lower triangle
+        dist_t triangleMin(std::size_t arc) const {
+            std::size_t x = tails_[arc];
+            std::size_t y = heads_[arc];
+            dist_t res = input_[arc];
+            for (std::size_t i = down_offsets_[x]; i < down_offsets_[x + 1]; i++) {
+                if (std::size_t other = findArc(down_[i].tail, y); other != NONE) {
+                    res = std::min(res, add(metric_[down_[i].arc], metric_[other]));
+                }
+            }
+            return res;
+        }
+
+        // basic customization, lower triangles of an arc are final before the arc itself
+        void customize() {
+            metric_ = input_;
+            for (std::size_t z = 0; z < vertexCount(); z++) {
+                for (std::size_t i = up_offsets_[z]; i < up_offsets_[z + 1]; i++) {
+                    for (std::size_t j = i + 1; j < up_offsets_[z + 1]; j++) {
+                        std::size_t arc = findArc(heads_[i], heads_[j]);
+                        CTPL_ASSERT(arc != NONE, "hierarchy isn't chordal");
+                        metric_[arc] = std::min(metric_[arc], add(metric_[i], metric_[j]));
+                    }
+                }
+            }
+        }
+
+        /*
+         * Recomputes the changed arc, then arcs whose lower triangles contain a changed arc,
+         * by increasing lower endpoint, so every arc is recomputed after all arcs it depends on
+         */
+        void recustomize(std::size_t changed) {
+            using item_t = std::pair<std::size_t, std::size_t>;
+            std::priority_queue<item_t, std::vector<item_t>, std::greater<>> pending;
+            auto push = [&](std::size_t arc) {
+                if (!queued_[arc]) {
+                    queued_[arc] = true;
+                    pending.emplace(tails_[arc], arc);
+                }
+            };
+            push(changed);
+            while (!pending.empty()) {
+                std::size_t arc = pending.top().second;
+                pending.pop();
+                queued_[arc] = false;
+                dist_t w = triangleMin(arc);
+                if (w == metric_[arc]) {
+                    continue;
+                }
+                metric_[arc] = w;
+                // the arc (x, y) is a lower side of the triangles x, y, z for upper neighbours z of x
+                std::size_t x = tails_[arc];
+                for (std::size_t i = up_offsets_[x]; i < up_offsets_[x + 1]; i++) {
+                    if (i != arc) {
+                        push(findArc(heads_[arc], heads_[i]));
+                    }
+                }
+            }
+        }
+
+        // relaxes the upward arcs of the elimination tree path of the root, i.e. of all ancestors of the root
+        void upwardSearch(std::size_t root, Search& search) {
+            search.dist[root] = 0;
+            for (std::size_t x = root; x != NONE;) {
+                search.touched.push_back(x);
+                CTPL_STAT_INC(settled_vertices);
+                for (std::size_t arc = up_offsets_[x]; arc < up_offsets_[x + 1]; arc++) {
+                    CTPL_STAT_INC(edge_relaxations);
+                    dist_t d = add(search.dist[x], metric_[arc]);
+                    if (d < search.dist[heads_[arc]]) {
+                        search.dist[heads_[arc]] = d;
+                        search.parent[heads_[arc]] = arc;
+                    }
+                }
+                // the elimination tree parent is the lowest upper neighbour
+                x = up_offsets_[x] == up_offsets_[x + 1] ? NONE : heads_[up_offsets_[x]];
+            }
+        }
+
+        // common ancestor with the shortest s - t distance through it or NONE
+        std::pair<std::size_t, dist_t> query(std::size_t s, std::size_t t) {
+            upwardSearch(s, forward_);
+            upwardSearch(t, backward_);
+            std::pair<std::size_t, dist_t> res = {NONE, INF};
+            for (std::size_t x : backward_.touched) {
+                dist_t d = add(forward_.dist[x], backward_.dist[x]);
+                if (d < res.second) {
+                    res = {x, d};
+                }
+            }
+            return res;
+        }
+
+        void resetQuery() {
+            for (Search* search : {&forward_, &backward_}) {
+                for (std::size_t x : search->touched) {
+                    search->dist[x] = INF;
+                    search->parent[x] = NONE;
+                }
+                search->touched.clear();
+            }
+        }
+
+        // appends ranks of the path from -> to over the arc without from itself
+        void unpack(std::size_t from, std::size_t to, std::size_t arc, std::vector<std::size_t>& out) const {
+            std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> stack = {{from, to, arc}};
+            while (!stack.empty()) {
+                auto [a, b, current] = stack.back();
+                stack.pop_back();
+                if (metric_[current] == input_[current]) {
+                    out.push_back(b);
+                    continue;
+                }
+                std::size_t x = tails_[current];
+                std::size_t y = heads_[current];
+                for (std::size_t i = down_offsets_[x]; i < down_offsets_[x + 1]; i++) {
+                    std::size_t other = findArc(down_[i].tail, y);
+                    if (other != NONE && add(metric_[down_[i].arc], metric_[other]) == metric_[current]) {
+                        std::size_t z = down_[i].tail;
+                        std::size_t az = a == x ? down_[i].arc : other;
+                        std::size_t zb = a == x ? other : down_[i].arc;
+                        // a -> z is unpacked first
+                        stack.emplace_back(z, b, zb);
+                        stack.emplace_back(a, z, az);
+                        break;
+                    }
+                }
+            }
+        }
+
+        Permutation<vertex_t> order_;
+        // arcs from lower to upper ranks grouped by the lower one, heads are sorted within a group
+        std::vector<std::size_t> up_offsets_{};
+        std::vector<std::size_t> heads_{};
+        std::vector<std::size_t> tails_{};
+        // the same arcs grouped by the upper rank
+        std::vector<std::size_t> down_offsets_{};
+        std::vector<DownArc> down_{};
+        // weights of graph edges (INF for shortcuts and banned edges), as built and current
+        std::vector<dist_t> original_{};
+        std::vector<dist_t> input_{};
+        // customized weights
+        std::vector<dist_t> metric_{};
+
+        Search forward_{};
+        Search backward_{};
+        std::vector<bool> queued_{};
+    };
+}
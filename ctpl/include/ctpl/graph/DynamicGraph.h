@@ -1,8 +1,10 @@
 #pragma once
 
 #include "IDynamicGraph.h"
+#include <ctpl/util/stats.h>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ctpl {
     template<typename vertex_t, typename edge_props_t>
@@ -10,6 +12,14 @@ namespace ctpl {
         template<typename builder_self_t>
         using Builder = GraphBuilder<vertex_t, edge_props_t, builder_self_t>;
         using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
+        using packed_props_t = PackedProps<edge_props_t>;
+        // unweighted graphs keep only neighbour ids, weighted ones keep the weight next to the id
+        using AdjList = std::conditional_t<std::is_empty_v<packed_props_t>,
+                                           std::unordered_set<vertex_t>,
+                                           std::unordered_map<vertex_t, packed_props_t>>;
+
+        static_assert(sizeof(typename AdjList::value_type) == sizeof(AdjacentVertex<vertex_t, edge_props_t>),
+                      "adjacency entry must be as compact as AdjacentVertex");
     public:
 
         template<typename builder_self_t>
@@ -20,16 +30,20 @@ namespace ctpl {
         }
 
         bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
+            CTPL_STAT_INC(edge_probes);
             if (auto it = graph_.find(u); it != graph_.end()) {
+                countCollisions(it->second, v);
                 return it->second.contains(v);
             }
             return false;
         }
 
         std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
+            CTPL_STAT_INC(edge_probes);
             if (auto it = graph_.find(u); it != graph_.end()) {
+                countCollisions(it->second, v);
                 if (auto it2 = it->second.find(v); it2 != it->second.end()) {
-                    return it2->second;
+                    return entryProps(*it2);
                 }
             }
 
@@ -38,42 +52,101 @@ namespace ctpl {
 
         void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
             if (auto it = graph_.find(vertex); it != graph_.end()) {
-                for (const auto& [v, props] : it->second) {
-                    visitor(vertex, v, props);
+                for (const auto& entry : it->second) {
+                    visitor(vertex, entryVertex(entry), entryProps(entry));
                 }
             }
         }
 
         void visitAllEdges(const Visitor& visitor) const override {
             for (const auto& [u, list] : graph_) {
-                for (const auto& [v, props] : list) {
+                for (const auto& entry : list) {
+                    vertex_t v = entryVertex(entry);
                     if constexpr (has_prop<Undirected, edge_props_t>) {
                         if (u < v) {
-                            visitor(u, v, props);
+                            visitor(u, v, entryProps(entry));
                         }
                     }
                     else {
-                        visitor(u, v, props);
+                        visitor(u, v, entryProps(entry));
                     }
                 }
             }
         }
 
         void addEdge(vertex_t u, vertex_t v, edge_props_t props) override {
-            graph_[u][v] = props;
+            insertEntry(graph_[u], v, props);
             if constexpr (has_prop<Undirected, edge_props_t>) {
-                graph_[v][u] = props;
+                insertEntry(graph_[v], u, props);
             }
         }
 
         void removeEdge(vertex_t u, vertex_t v) override {
-            graph_[u].erase(v);
+            eraseEntry(u, v);
             if constexpr (has_prop<Undirected, edge_props_t>) {
-                graph_[v].erase(u);
+                eraseEntry(v, u);
+            }
+        }
+
+        /**
+         * @brief Drops adjacency lists emptied by removals and rehashes all tables to fit their size
+         */
+        void compact() override {
+            std::erase_if(graph_, [](const auto& item) {
+                return item.second.empty();
+            });
+            for (auto& [u, list] : graph_) {
+                list.rehash(0);
+            }
+            graph_.rehash(0);
+        }
+
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            MemoryUsage res;
+            res.add("vertex table", hashBucketsMemory(graph_) + hashNodesMemory(graph_));
+            for (const auto& [u, list] : graph_) {
+                res.add("adjacency buckets", hashBucketsMemory(list));
+                res.add("adjacency entries", hashNodesMemory(list));
             }
+            return res;
         }
 
     private:
-        std::unordered_map<vertex_t, std::unordered_map<vertex_t, edge_props_t>> graph_{};
+        static void countCollisions([[maybe_unused]] const AdjList& list, [[maybe_unused]] vertex_t v) {
+            CTPL_STAT_ADD(hash_collisions, list.empty() ? 0 : list.bucket_size(list.bucket(v)) - list.count(v));
+        }
+
+        static vertex_t entryVertex(const typename AdjList::value_type& entry) {
+            if constexpr (std::is_empty_v<packed_props_t>) {
+                return entry;
+            } else {
+                return entry.first;
+            }
+        }
+
+        static edge_props_t entryProps(const typename AdjList::value_type& entry) {
+            if constexpr (std::is_empty_v<packed_props_t>) {
+                return {};
+            } else {
+                return entry.second.unpack();
+            }
+        }
+
+        void eraseEntry(vertex_t u, vertex_t v) {
+            if (auto it = graph_.find(u); it != graph_.end()) {
+                it->second.erase(v);
+            }
+        }
+
+        static void insertEntry(AdjList& list, vertex_t v, edge_props_t props) {
+            if constexpr (std::is_empty_v<packed_props_t>) {
+                list.insert(v);
+            } else {
+                list.insert_or_assign(v, packed_props_t::pack(props));
+            }
+        }
+
+        std::unordered_map<vertex_t, AdjList> graph_{};
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <type_traits>
 
@@ -24,14 +25,6 @@ namespace ctpl {
         vertex_t v;
     };
 
-    template<typename vertex_t, typename edge_props_t = EdgeProps<>>
-    struct AdjacentVertex : edge_props_t {
-        AdjacentVertex(vertex_t vertex, edge_props_t props) : edge_props_t((props)), v(vertex) {
-        }
-
-        vertex_t v;
-    };
-
     // props
 
     template<typename weight_t>
@@ -48,6 +41,27 @@ namespace ctpl {
     struct Unweighted {
     };
 
+    /**
+     * @brief Promises that every edge weight lies in [0, max_weight], lets algorithms use integer queues
+     */
+    template<auto max_weight>
+    struct MaxWeight {
+        static constexpr auto value = max_weight;
+    };
+
+    namespace detail {
+        template<auto max_weight>
+        constexpr auto maxWeightOf(const MaxWeight<max_weight>*) {
+            return max_weight;
+        }
+    }
+
+    template<typename props_t>
+    concept HasMaxWeight = requires(const props_t* props) { detail::maxWeightOf(props); };
+
+    template<HasMaxWeight props_t>
+    static constexpr auto max_weight_of = detail::maxWeightOf(static_cast<const props_t*>(nullptr));
+
     template<typename T>
     struct IsWeighted {
         using underlying_type = std::nullopt_t;
@@ -75,4 +89,58 @@ namespace ctpl {
         using underlying_type = std::conditional_t<IsWeighted<T>::value, typename IsWeighted<T>::underlying_type, typename IsPropsWeighted<EdgeProps<Args...>>::underlying_type>;
     };
 
+    /**
+     * @brief Storage representation of edge props: tags are compile-time traits only, so the weight
+     * (if the props are weighted) is the sole field, unweighted props take no storage at all
+     */
+    template<typename edge_props_t, bool = IsPropsWeighted<edge_props_t>::value>
+    struct PackedProps {
+        static PackedProps pack(const edge_props_t&) noexcept {
+            return {};
+        }
+
+        edge_props_t unpack() const noexcept {
+            return {};
+        }
+    };
+
+    template<typename edge_props_t>
+    struct PackedProps<edge_props_t, true> {
+        using weight_t = IsPropsWeighted<edge_props_t>::underlying_type;
+
+        static PackedProps pack(const edge_props_t& props) noexcept {
+            return {static_cast<const Weighted<weight_t>&>(props).weight};
+        }
+
+        edge_props_t unpack() const noexcept {
+            edge_props_t props{};
+            static_cast<Weighted<weight_t>&>(props).weight = weight;
+            return props;
+        }
+
+        weight_t weight;
+    };
+
+    template<typename vertex_t, typename edge_props_t = EdgeProps<>>
+    struct AdjacentVertex {
+        AdjacentVertex(vertex_t vertex, edge_props_t props) : v(vertex), packed(PackedProps<edge_props_t>::pack(props)) {
+        }
+
+        edge_props_t props() const noexcept {
+            return packed.unpack();
+        }
+
+        vertex_t v;
+        [[no_unique_address]] PackedProps<edge_props_t> packed;
+    };
+
+    static_assert(std::is_empty_v<EdgeProps<Undirected, Unweighted>>);
+    static_assert(std::is_empty_v<PackedProps<EdgeProps<Directed, Unweighted>>>);
+    static_assert(sizeof(EdgeProps<Undirected, Weighted<std::int32_t>>) == sizeof(std::int32_t));
+    static_assert(sizeof(AdjacentVertex<std::uint32_t, EdgeProps<Undirected, Unweighted>>) == sizeof(std::uint32_t));
+    static_assert(sizeof(AdjacentVertex<std::uint32_t, EdgeProps<Undirected, Weighted<std::int32_t>>>) ==
+                  sizeof(std::uint32_t) + sizeof(std::int32_t));
+    static_assert(sizeof(Edge<std::uint32_t, EdgeProps<Directed, Weighted<std::int32_t>>>) ==
+                  2 * sizeof(std::uint32_t) + sizeof(std::int32_t));
+
 }
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Edge.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace ctpl {
+    template<typename vertex_t>
+    using EdgeKey = std::pair<vertex_t, vertex_t>;
+
+    /**
+     * @return key of the edge (u, v) in hash containers, endpoints of undirected edges are ordered
+     */
+    template<typename edge_props_t, typename vertex_t>
+    EdgeKey<vertex_t> edgeKey(vertex_t u, vertex_t v) {
+        if constexpr (has_prop<Undirected, edge_props_t>) {
+            return {std::min(u, v), std::max(u, v)};
+        } else {
+            return {u, v};
+        }
+    }
+
+    template<typename vertex_t>
+    struct EdgeKeyHash {
+        std::size_t operator()(const EdgeKey<vertex_t>& e) const noexcept {
+            std::size_t h = std::hash<vertex_t>()(e.first);
+            return h ^ (std::hash<vertex_t>()(e.second) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+        }
+    };
+}
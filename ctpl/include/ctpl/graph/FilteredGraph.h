@@ -0,0 +1,106 @@
+#pragma once
+
+#include <ctpl/graph/EdgeKey.h>
+#include <ctpl/graph/IGraph.h>
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+
+namespace ctpl {
+    /**
+     * @brief Read-only view of a graph with some edges and vertices hidden, the underlying graph isn't copied
+     * and must outlive the view
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class FilteredGraph : public IGraph<vertex_t, edge_props_t> {
+        using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
+        using edge_key_t = EdgeKey<vertex_t>;
+    public:
+        explicit FilteredGraph(const IGraph<vertex_t, edge_props_t>& graph) : graph_(graph) {
+        }
+
+        void hideEdge(vertex_t u, vertex_t v) {
+            hidden_.insert(edgeKey<edge_props_t>(u, v));
+        }
+
+        void showEdge(vertex_t u, vertex_t v) {
+            hidden_.erase(edgeKey<edge_props_t>(u, v));
+        }
+
+        [[nodiscard]]
+        bool isEdgeHidden(vertex_t u, vertex_t v) const {
+            return (!hidden_.empty() && hidden_.contains(edgeKey<edge_props_t>(u, v))) || isVertexHidden(u) ||
+                   isVertexHidden(v);
+        }
+
+        /**
+         * @brief Hides all edges incident to the vertex
+         */
+        void hideVertex(vertex_t u) {
+            hidden_vertices_.insert(u);
+        }
+
+        void showVertex(vertex_t u) {
+            hidden_vertices_.erase(u);
+        }
+
+        [[nodiscard]]
+        bool isVertexHidden(vertex_t u) const {
+            return !hidden_vertices_.empty() && hidden_vertices_.contains(u);
+        }
+
+        /**
+         * @brief Shows all hidden edges and vertices
+         */
+        void clear() {
+            hidden_.clear();
+            hidden_vertices_.clear();
+        }
+
+        void visitAllEdges(const Visitor& visitor) const override {
+            graph_.visitAllEdges([&](vertex_t u, vertex_t v, edge_props_t props) {
+                if (!isEdgeHidden(u, v)) {
+                    visitor(u, v, props);
+                }
+            });
+        }
+
+        void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
+            if (isVertexHidden(vertex)) {
+                return;
+            }
+            graph_.visitAdjacentVertices(vertex, [&](vertex_t u, vertex_t v, edge_props_t props) {
+                if (!isEdgeHidden(u, v)) {
+                    visitor(u, v, props);
+                }
+            });
+        }
+
+        bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
+            return !isEdgeHidden(u, v) && graph_.isEdgeBelongs(u, v);
+        }
+
+        std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
+            if (isEdgeHidden(u, v)) {
+                return std::nullopt;
+            }
+            return graph_.getEdgeProps(u, v);
+        }
+
+        /**
+         * @return footprint of the hidden edge set, the underlying graph isn't counted
+         */
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            return MemoryUsage()
+                    .add("hidden edges", hashBucketsMemory(hidden_) + hashNodesMemory(hidden_))
+                    .add("hidden vertices", hashBucketsMemory(hidden_vertices_) + hashNodesMemory(hidden_vertices_));
+        }
+
+    private:
+        const IGraph<vertex_t, edge_props_t>& graph_;
+        std::unordered_set<edge_key_t, EdgeKeyHash<vertex_t>> hidden_{};
+        std::unordered_set<vertex_t> hidden_vertices_{};
+    };
+}
@@ -2,13 +2,58 @@
 
 #include "IGraph.h"
 #include "Builder.h"
+#include <cstdint>
+#include <span>
 
 namespace ctpl {
+    template<typename vertex_t, typename edge_props_t>
+    struct Mutation {
+        enum class Type : std::uint8_t {
+            ADD,
+            REMOVE
+        };
+
+        Type type;
+        vertex_t u;
+        vertex_t v;
+        // ignored by REMOVE
+        [[no_unique_address]] edge_props_t props{};
+
+        static Mutation addEdge(vertex_t u, vertex_t v, edge_props_t props) {
+            return {Type::ADD, u, v, props};
+        }
+
+        static Mutation removeEdge(vertex_t u, vertex_t v) {
+            return {Type::REMOVE, u, v};
+        }
+    };
+
     template<typename vertex_t, typename edge_props_t>
     class IDynamicGraph : public IGraph<vertex_t, edge_props_t> {
     public:
         virtual void addEdge(vertex_t u, vertex_t v, edge_props_t props) = 0;
 
         virtual void removeEdge(vertex_t u, vertex_t v) = 0;
+
+        /**
+         * @brief Applies the mutations in order, the result is the same as of the addEdge / removeEdge calls one by one.
+         * Implementations with derived structures (indices, published snapshots, journals) override it
+         * to update them once per batch instead of once per edge
+         */
+        virtual void applyMutations(std::span<const Mutation<vertex_t, edge_props_t>> mutations) {
+            for (const auto& m : mutations) {
+                if (m.type == Mutation<vertex_t, edge_props_t>::Type::ADD) {
+                    addEdge(m.u, m.v, m.props);
+                } else {
+                    removeEdge(m.u, m.v);
+                }
+            }
+        }
+
+        /**
+         * @brief Releases storage left behind by removed edges, doesn't change the graph
+         */
+        virtual void compact() {
+        }
     };
 }
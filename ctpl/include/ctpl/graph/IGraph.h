@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Edge.h"
+#include <ctpl/util/memory.h>
 #include <cstdint>
 #include <functional>
 #include <optional>
@@ -26,5 +27,13 @@ namespace ctpl {
         virtual bool isEdgeBelongs(vertex_t u, vertex_t v) const = 0;
 
         virtual std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const = 0;
+
+        /**
+         * @return approximate heap footprint of the graph, empty if the implementation doesn't report it
+         */
+        [[nodiscard]]
+        virtual MemoryUsage memoryUsage() const {
+            return {};
+        }
     };
 }
@@ -4,75 +4,200 @@
 #include <ctpl/graph/IGraph.h>
 #include <ctpl/graph/Builder.h>
 #include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
 #include <algorithm>
+#include <numeric>
+#include <span>
 #include <vector>
 
 namespace ctpl {
+    namespace detail {
+        /**
+         * @brief Queries over CSR arrays shared by IndexedGraph and IndexedGraphView,
+         * self_t provides offsets(), targets() and packedProps() (see IndexedGraph::offsets())
+         */
+        template<typename self_t, typename vertex_t, typename edge_props_t>
+        class CsrGraph : public IGraph<vertex_t, edge_props_t> {
+            using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
+            using packed_props_t = PackedProps<edge_props_t>;
+            static constexpr bool HAS_PROPS = !std::is_empty_v<packed_props_t>;
+        public:
+            bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
+                return find(u, v) != NOT_FOUND;
+            }
+
+            std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
+                if (std::size_t i = find(u, v); i != NOT_FOUND) {
+                    return propsAt(i);
+                }
+                return std::nullopt;
+            }
+
+            void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
+                if (!isVertexInRange(vertex)) {
+                    return;
+                }
+                auto offsets = self().offsets();
+                auto targets = self().targets();
+                for (std::size_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+                    visitor(vertex, targets[i], propsAt(i));
+                }
+            }
+
+            void visitAllEdges(const Visitor& visitor) const override {
+                auto offsets = self().offsets();
+                auto targets = self().targets();
+                for (std::size_t u = 0; u < vertexCount(); ++u) {
+                    auto vertex = static_cast<vertex_t>(u);
+                    for (std::size_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+                        if constexpr (has_prop<Undirected, edge_props_t>) {
+                            if (targets[i] < vertex) {
+                                continue;
+                            }
+                        }
+                        visitor(vertex, targets[i], propsAt(i));
+                    }
+                }
+            }
+
+            [[nodiscard]]
+            std::size_t vertexCount() const noexcept {
+                return self().offsets().size() - 1;
+            }
+
+            /**
+             * @return sorted ids of the vertices adjacent to u
+             */
+            [[nodiscard]]
+            std::span<const vertex_t> adjacentVertices(vertex_t u) const noexcept {
+                if (!isVertexInRange(u)) {
+                    return {};
+                }
+                auto offsets = self().offsets();
+                return self().targets().subspan(offsets[u], offsets[u + 1] - offsets[u]);
+            }
+
+        private:
+            static constexpr std::size_t NOT_FOUND = -1;
+
+            const self_t& self() const noexcept {
+                return static_cast<const self_t&>(*this);
+            }
+
+            bool isVertexInRange(vertex_t u) const noexcept {
+                return 0 <= u && static_cast<std::size_t>(u) < vertexCount();
+            }
+
+            edge_props_t propsAt(std::size_t i) const noexcept {
+                if constexpr (HAS_PROPS) {
+                    return self().packedProps()[i].unpack();
+                } else {
+                    return {};
+                }
+            }
+
+            std::size_t find(vertex_t u, vertex_t v) const {
+                CTPL_STAT_INC(edge_probes);
+                auto adj = adjacentVertices(u);
+                auto it = std::lower_bound(adj.begin(), adj.end(), v);
+                return it != adj.end() && *it == v ? static_cast<std::size_t>(&*it - self().targets().data()) : NOT_FOUND;
+            }
+        };
+    }
+
+    /**
+     * @brief Immutable graph in CSR layout: neighbour ids of every vertex are stored contiguously and sorted,
+     * weights (if any) are kept in a parallel array, so adjacency lists can be fed to vectorized kernels
+     */
     template<typename vertex_t, typename edge_props_t>
-    class IndexedGraph : IGraph<vertex_t, edge_props_t> {
-        using AdjVertex = AdjacentVertex<vertex_t, edge_props_t>;
-        using AdjList = std::vector<AdjVertex>;
-        using AdjLists = std::vector<AdjList>;
-        using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
-        using Edge = Edge<vertex_t, edge_props_t>;
-        using Builder = GraphBuilder<vertex_t, edge_props_t>;
+    class IndexedGraph : public detail::CsrGraph<IndexedGraph<vertex_t, edge_props_t>, vertex_t, edge_props_t> {
+        using edge = Edge<vertex_t, edge_props_t>;
+        using packed_props_t = PackedProps<edge_props_t>;
+        template<typename builder_self_t>
+        using Builder = GraphBuilder<vertex_t, edge_props_t, builder_self_t>;
+        static constexpr bool HAS_PROPS = !std::is_empty_v<packed_props_t>;
     public:
 
-        IndexedGraph(const Builder& builder) { // NOLINT
-            CTPL_ASSERT(builder.vertexCount() != Builder::UNKNOWN_VERTEX_COUNT, "vertex count must be set");
-            adj_lists_.resize(builder.vertex_count_);
-            for (const Edge& e : builder.edges_) {
-                CTPL_ASSERT(0 <= e.u && e.u < adj_lists_.size(), "vertex number is out of range");
-                CTPL_ASSERT(0 <= e.v && e.v < adj_lists_.size(), "vertex number is out of range");
-                adj_lists_[e.u].push_back(AdjVertex(e.v, e.props));
+        /**
+         * @brief Vertices are expected to be numbered from 0, if vertex count isn't set, it's deduced from the edges.
+         * Repeated edges are merged, the last one wins
+         */
+        template<typename builder_self_t>
+        IndexedGraph(const Builder<builder_self_t>& builder) { // NOLINT
+            std::size_t vertex_count = builder.deducedVertexCount();
+
+            std::vector<AdjacentVertex<vertex_t, edge_props_t>> adj;
+            std::vector<std::size_t> adj_owner;
+            adj.reserve(builder.edges().size() * 2);
+            adj_owner.reserve(builder.edges().size() * 2);
+            for (const edge& e : builder.edges()) {
+                CTPL_ASSERT(0 <= e.u && static_cast<std::size_t>(e.u) < vertex_count, "vertex number is out of range");
+                CTPL_ASSERT(0 <= e.v && static_cast<std::size_t>(e.v) < vertex_count, "vertex number is out of range");
+                adj.emplace_back(e.v, e);
+                adj_owner.push_back(e.u);
                 if constexpr (has_prop<Undirected, edge_props_t>) {
-                    adj_lists_[e.v].push_back(AdjVertex(e.u, e.props));
+                    if (e.u != e.v) {
+                        adj.emplace_back(e.u, e);
+                        adj_owner.push_back(e.v);
+                    }
                 }
             }
 
-            for (AdjList& l : adj_lists_) {
-                std::sort(l.begin(), l.end(), [](const AdjVertex& lhs, const AdjVertex& rhs) {
-                    return lhs.v < rhs.v;
-                });
+            std::vector<std::size_t> order(adj.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+                return std::pair(adj_owner[lhs], adj[lhs].v) < std::pair(adj_owner[rhs], adj[rhs].v);
+            });
+
+            offsets_.assign(vertex_count + 1, 0);
+            targets_.reserve(order.size());
+            for (std::size_t i = 0; i < order.size(); i++) {
+                const auto& cur = adj[order[i]];
+                bool is_last = i + 1 == order.size() || adj_owner[order[i + 1]] != adj_owner[order[i]] ||
+                               adj[order[i + 1]].v != cur.v;
+                if (!is_last) {
+                    continue;
+                }
+                targets_.push_back(cur.v);
+                if constexpr (HAS_PROPS) {
+                    props_.push_back(cur.packed);
+                }
+                ++offsets_[adj_owner[order[i]] + 1];
             }
+            std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
         }
 
-        bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
-            CTPL_ASSERT(0 <= u && u < adj_lists_.size(), "vertex number is out of range");
-            CTPL_ASSERT(0 <= v && v < adj_lists_.size(), "vertex number is out of range");
-            auto it = std::lower_bound(adj_lists_[u].begin(), adj_lists_[u].end(), [](const AdjVertex& lhs, const AdjVertex& rhs) {
-                return lhs.v < rhs.v;
-            });
-            return it != adj_lists_[u].end() && it->v == v;
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            return MemoryUsage()
+                    .add("offsets", vectorMemory(offsets_))
+                    .add("adjacency entries", vectorMemory(targets_))
+                    .add("props", vectorMemory(props_));
         }
 
-        std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
-            auto it = std::lower_bound(adj_lists_[u].begin(), adj_lists_[u].end(), [](const AdjVertex& lhs, const AdjVertex& rhs) {
-                return lhs.v < rhs.v;
-            });
-
-            if (it == adj_lists_[u].end() || it->v != v) {
-                return *it;
-            }
+        /**
+         * @return CSR arrays: adjacency of u is targets()[offsets()[u], offsets()[u + 1]), packedProps() is parallel
+         * to targets() and is empty for graphs without props
+         */
+        [[nodiscard]]
+        std::span<const std::size_t> offsets() const noexcept {
+            return offsets_;
         }
 
-        void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
-            CTPL_ASSERT(0 <= vertex && vertex < adj_lists_.size(), "vertex number is out of range");
-            for (const AdjVertex& adj : adj_lists_[vertex]) {
-                visitor(vertex, adj.v, adj);
-            }
+        [[nodiscard]]
+        std::span<const vertex_t> targets() const noexcept {
+            return targets_;
         }
 
-        void visitAllEdges(const Visitor& visitor) const override {
-            for (std::size_t u = 0; u < adj_lists_.size(); ++u) {
-                for (const AdjVertex& adj : adj_lists_[u]) {
-                    visitor(u, adj.v, adj);
-                }
-            }
+        [[nodiscard]]
+        std::span<const packed_props_t> packedProps() const noexcept {
+            return props_;
         }
 
     private:
-        AdjLists adj_lists_{};
+        std::vector<std::size_t> offsets_ = {0};
+        std::vector<vertex_t> targets_{};
+        std::vector<packed_props_t> props_{};
     };
 
 }
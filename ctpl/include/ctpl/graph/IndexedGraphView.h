@@ -0,0 +1,48 @@
+#pragma once
+
+#include <ctpl/graph/IndexedGraph.h>
+#include <ctpl/util/assert.h>
+#include <span>
+
+namespace ctpl {
+    /**
+     * @brief IndexedGraph over CSR arrays owned by someone else (e.g. a shared memory segment),
+     * the arrays aren't copied and must outlive the view. See IndexedGraph::offsets() for the layout
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class IndexedGraphView : public detail::CsrGraph<IndexedGraphView<vertex_t, edge_props_t>, vertex_t, edge_props_t> {
+        using packed_props_t = PackedProps<edge_props_t>;
+        static constexpr bool HAS_PROPS = !std::is_empty_v<packed_props_t>;
+    public:
+        IndexedGraphView(std::span<const std::size_t> offsets, std::span<const vertex_t> targets,
+                         std::span<const packed_props_t> props)
+                : offsets_(offsets), targets_(targets), props_(props) {
+            CTPL_ASSERT(!offsets.empty() && offsets.back() == targets.size(), "offsets don't match targets");
+            CTPL_ASSERT(!HAS_PROPS || props.size() == targets.size(), "props don't match targets");
+        }
+
+        explicit IndexedGraphView(const IndexedGraph<vertex_t, edge_props_t>& graph)
+                : IndexedGraphView(graph.offsets(), graph.targets(), graph.packedProps()) {
+        }
+
+        [[nodiscard]]
+        std::span<const std::size_t> offsets() const noexcept {
+            return offsets_;
+        }
+
+        [[nodiscard]]
+        std::span<const vertex_t> targets() const noexcept {
+            return targets_;
+        }
+
+        [[nodiscard]]
+        std::span<const packed_props_t> packedProps() const noexcept {
+            return props_;
+        }
+
+    private:
+        std::span<const std::size_t> offsets_;
+        std::span<const vertex_t> targets_;
+        std::span<const packed_props_t> props_;
+    };
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <ctpl/graph/IDynamicGraph.h>
+#include <ctpl/util/assert.h>
+#include <map>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Dynamic graph that logs every mutation, so a batch of changes (e.g. bans applied while exploring
+     * a game tree) can be reverted with rollback() in time proportional to the number of changes.
+     * graph_t is any IDynamicGraph implementation, JournaledGraph is usable wherever graph_t is
+     */
+    template<typename graph_t>
+    class JournaledGraph : public graph_t {
+        using vertex_t = graph_t::vertex;
+        using edge_props_t = graph_t::edge_props;
+        using packed_props_t = PackedProps<edge_props_t>;
+
+        static_assert(std::is_base_of_v<IDynamicGraph<vertex_t, edge_props_t>, graph_t>,
+                      "graph_t must be inherited from IDynamicGraph");
+
+        struct JournalEntry {
+            vertex_t u;
+            vertex_t v;
+            // whether (u, v) existed before the mutation, and its props if so
+            bool existed;
+            [[no_unique_address]] packed_props_t props;
+        };
+    public:
+        // position in the journal, valid until the journal is rolled back past it or cleared
+        using checkpoint_t = std::size_t;
+
+        using graph_t::graph_t;
+
+        explicit JournaledGraph(graph_t graph) : graph_t(std::move(graph)) {
+        }
+
+        void addEdge(vertex_t u, vertex_t v, edge_props_t props) override {
+            if (!in_batch_) {
+                if (auto previous = graph_t::getEdgeProps(u, v)) {
+                    journal_.push_back({u, v, true, packed_props_t::pack(*previous)});
+                } else {
+                    journal_.push_back({u, v, false, {}});
+                }
+            }
+            graph_t::addEdge(u, v, props);
+        }
+
+        void removeEdge(vertex_t u, vertex_t v) override {
+            if (!in_batch_) {
+                auto previous = graph_t::getEdgeProps(u, v);
+                if (!previous) {
+                    return;
+                }
+                journal_.push_back({u, v, true, packed_props_t::pack(*previous)});
+            }
+            graph_t::removeEdge(u, v);
+        }
+
+        /**
+         * @brief Journals the whole batch upfront, then hands it to graph_t::applyMutations in one piece
+         */
+        void applyMutations(std::span<const Mutation<vertex_t, edge_props_t>> mutations) override {
+            // state of the edges after the mutations journaled so far
+            std::map<std::pair<vertex_t, vertex_t>, std::optional<packed_props_t>> pending;
+            for (const auto& m : mutations) {
+                std::pair<vertex_t, vertex_t> key(m.u, m.v);
+                if constexpr (has_prop<Undirected, edge_props_t>) {
+                    key = std::minmax(m.u, m.v);
+                }
+                std::optional<packed_props_t> previous;
+                if (auto it = pending.find(key); it != pending.end()) {
+                    previous = it->second;
+                } else if (auto props = graph_t::getEdgeProps(m.u, m.v)) {
+                    previous = packed_props_t::pack(*props);
+                }
+
+                if (m.type == Mutation<vertex_t, edge_props_t>::Type::ADD) {
+                    journal_.push_back({m.u, m.v, previous.has_value(), previous.value_or(packed_props_t{})});
+                    pending[key] = packed_props_t::pack(m.props);
+                } else if (previous) {
+                    journal_.push_back({m.u, m.v, true, *previous});
+                    pending[key] = std::nullopt;
+                }
+            }
+
+            // graph_t may apply the batch through addEdge / removeEdge, they mustn't journal it again
+            in_batch_ = true;
+            try {
+                graph_t::applyMutations(mutations);
+            } catch (...) {
+                in_batch_ = false;
+                throw;
+            }
+            in_batch_ = false;
+        }
+
+        [[nodiscard]]
+        checkpoint_t checkpoint() const noexcept {
+            return journal_.size();
+        }
+
+        /**
+         * @brief Reverts all mutations made after the checkpoint, newest first
+         */
+        void rollback(checkpoint_t checkpoint) {
+            CTPL_ASSERT(checkpoint <= journal_.size(), "checkpoint is no longer valid");
+            while (journal_.size() > checkpoint) {
+                const JournalEntry& entry = journal_.back();
+                if (entry.existed) {
+                    graph_t::addEdge(entry.u, entry.v, entry.props.unpack());
+                } else {
+                    graph_t::removeEdge(entry.u, entry.v);
+                }
+                journal_.pop_back();
+            }
+        }
+
+        /**
+         * @brief Forgets the journal, the current state can't be rolled back anymore, all checkpoints are invalidated
+         */
+        void clearJournal() noexcept {
+            journal_.clear();
+        }
+
+        void compact() override {
+            graph_t::compact();
+            journal_.shrink_to_fit();
+        }
+
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            return graph_t::memoryUsage().add("journal", vectorMemory(journal_));
+        }
+
+        [[nodiscard]]
+        std::size_t journalSize() const noexcept {
+            return journal_.size();
+        }
+
+    private:
+        std::vector<JournalEntry> journal_{};
+        bool in_batch_ = false;
+    };
+}
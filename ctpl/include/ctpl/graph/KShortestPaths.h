@@ -0,0 +1,161 @@
+#pragma once
+
+#include <ctpl/graph/FilteredGraph.h>
+#include <ctpl/graph/algo.h>
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace ctpl {
+    template<typename vertex_t, typename edge_props_t>
+    struct WeightedPath {
+        std::vector<vertex_t> vertices;
+        distance_t<edge_props_t> length;
+    };
+
+    /**
+     * @brief Lazy enumeration of simple paths from source to target in non-decreasing length order
+     * (Yen's algorithm). Spur searches of a path start only from its deviation point from the parent path
+     * (Lawler's improvement), spurs before it were already tried for the parent.
+     * The graph must stay unchanged while the enumerator is in use
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class KShortestPaths {
+        using dist_t = distance_t<edge_props_t>;
+        using path_t = WeightedPath<vertex_t, edge_props_t>;
+
+        struct Candidate {
+            // left to right sum over the vertices, so a path reached from different parents gets the same key
+            dist_t length;
+            std::vector<vertex_t> vertices;
+            // index of the vertex where the path leaves its parent, duplicates keep the smallest one
+            mutable std::size_t spur_index;
+
+            bool operator<(const Candidate& other) const {
+                return std::tie(length, vertices) < std::tie(other.length, other.vertices);
+            }
+        };
+    public:
+        KShortestPaths(const IGraph<vertex_t, edge_props_t>& graph, vertex_t source, vertex_t target)
+                : graph_(graph), filtered_(graph), target_(target) {
+            if (auto first = spurPath(source)) {
+                addCandidate(std::move(first->vertices), 0);
+            }
+        }
+
+        /**
+         * @return next shortest simple path or std::nullopt if all of them were enumerated
+         */
+        std::optional<path_t> next() {
+            if (!found_.empty()) {
+                addCandidates(found_.back(), spur_indices_.back());
+            }
+            if (candidates_.empty()) {
+                return std::nullopt;
+            }
+            auto node = candidates_.extract(candidates_.begin());
+            Candidate& best = node.value();
+            found_.push_back({std::move(best.vertices), best.length});
+            spur_indices_.push_back(best.spur_index);
+            return found_.back();
+        }
+
+        /**
+         * @return paths returned by next() so far
+         */
+        [[nodiscard]]
+        const std::vector<path_t>& found() const noexcept {
+            return found_;
+        }
+
+    private:
+        void addCandidate(std::vector<vertex_t> vertices, std::size_t spur_index) {
+            dist_t length = 0;
+            for (std::size_t i = 0; i + 1 < vertices.size(); i++) {
+                length += edgeLength(*graph_.getEdgeProps(vertices[i], vertices[i + 1]));
+            }
+            auto [it, inserted] = candidates_.insert({length, std::move(vertices), spur_index});
+            if (!inserted) {
+                it->spur_index = std::min(it->spur_index, spur_index);
+            }
+        }
+
+        void addCandidates(const path_t& path, std::size_t first_spur_index) {
+            for (std::size_t i = first_spur_index; i + 1 < path.vertices.size(); i++) {
+                spurFrom(path.vertices, i);
+            }
+        }
+
+        // tries to leave the path at vertices[i] by an edge not used by the found paths with the same root
+        void spurFrom(const std::vector<vertex_t>& vertices, std::size_t i) {
+            filtered_.clear();
+            for (std::size_t j = 0; j < i; j++) {
+                filtered_.hideVertex(vertices[j]);
+            }
+            for (const path_t& other : found_) {
+                const auto& o = other.vertices;
+                if (o.size() > i + 1 && std::equal(vertices.begin(), vertices.begin() + i + 1, o.begin())) {
+                    filtered_.hideEdge(o[i], o[i + 1]);
+                }
+            }
+
+            auto spur = spurPath(vertices[i]);
+            if (!spur) {
+                return;
+            }
+            std::vector<vertex_t> candidate(vertices.begin(), vertices.begin() + i);
+            candidate.insert(candidate.end(), spur->vertices.begin(), spur->vertices.end());
+            addCandidate(std::move(candidate), i);
+        }
+
+        std::optional<path_t> spurPath(vertex_t from) {
+            std::unordered_map<vertex_t, vertex_t> parents;
+            std::optional<dist_t> length;
+            shortestPathsCustom(static_cast<const IGraph<vertex_t, edge_props_t>&>(filtered_), from,
+                                [&](vertex_t u) { return parents.contains(u); },
+                                [&](vertex_t u, vertex_t v) { parents[v] = u; },
+                                [&](vertex_t v, dist_t d) {
+                                    if (v == target_) {
+                                        length = d;
+                                    }
+                                });
+            if (!length) {
+                return std::nullopt;
+            }
+            std::vector<vertex_t> path = {target_};
+            while (path.back() != from) {
+                path.push_back(parents[path.back()]);
+            }
+            std::reverse(path.begin(), path.end());
+            return path_t{std::move(path), *length};
+        }
+
+        const IGraph<vertex_t, edge_props_t>& graph_;
+        FilteredGraph<vertex_t, edge_props_t> filtered_;
+        vertex_t target_;
+        std::vector<path_t> found_{};
+        std::vector<std::size_t> spur_indices_{};
+        std::set<Candidate> candidates_{};
+    };
+
+    /**
+     * @return at most k shortest simple paths from source to target in non-decreasing length order
+     */
+    template<typename vertex_t, typename edge_props_t>
+    std::vector<WeightedPath<vertex_t, edge_props_t>>
+    kShortestPaths(const IGraph<vertex_t, edge_props_t>& graph, vertex_t source, vertex_t target, std::size_t k) {
+        KShortestPaths<vertex_t, edge_props_t> paths(graph, source, target);
+        std::vector<WeightedPath<vertex_t, edge_props_t>> res;
+        while (res.size() < k) {
+            auto path = paths.next();
+            if (!path) {
+                break;
+            }
+            res.push_back(std::move(*path));
+        }
+        return res;
+    }
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <ctpl/graph/IDynamicGraph.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Graph on vertices [0, n) backed by a packed bit matrix and a dense weight matrix:
+     * O(1) edge test, insertion and removal, neighbours are scanned word by word.
+     * Intended for small dense instances, memory is O(n^2)
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class MatrixGraph : public IDynamicGraph<vertex_t, edge_props_t> {
+        using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
+        using packed_props_t = PackedProps<edge_props_t>;
+        using word_t = std::uint64_t;
+        template<typename builder_self_t>
+        using Builder = GraphBuilder<vertex_t, edge_props_t, builder_self_t>;
+        static constexpr bool HAS_PROPS = !std::is_empty_v<packed_props_t>;
+        static constexpr std::size_t WORD_BITS = 64;
+    public:
+        explicit MatrixGraph(std::size_t vertex_count) : vertex_count_(vertex_count),
+                                                        words_per_row_((vertex_count + WORD_BITS - 1) / WORD_BITS),
+                                                        bits_(vertex_count * words_per_row_, 0) {
+            if constexpr (HAS_PROPS) {
+                props_.resize(vertex_count * vertex_count);
+            }
+        }
+
+        /**
+         * @brief Vertices are expected to be numbered from 0, if vertex count isn't set, it's deduced from the edges
+         */
+        template<typename builder_self_t>
+        MatrixGraph(const Builder<builder_self_t>& builder) : MatrixGraph(builder.deducedVertexCount()) { // NOLINT
+            for (const Edge<vertex_t, edge_props_t>& e : builder.edges()) {
+                addEdge(e.u, e.v, e);
+            }
+        }
+
+        bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
+            CTPL_STAT_INC(edge_probes);
+            return isVertexInRange(u) && isVertexInRange(v) && testBit(u, v);
+        }
+
+        std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
+            if (!isEdgeBelongs(u, v)) {
+                return std::nullopt;
+            }
+            return propsAt(u, v);
+        }
+
+        void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
+            if (!isVertexInRange(vertex)) {
+                return;
+            }
+            visitRow(vertex, 0, visitor);
+        }
+
+        void visitAllEdges(const Visitor& visitor) const override {
+            for (std::size_t u = 0; u < vertex_count_; u++) {
+                if constexpr (has_prop<Undirected, edge_props_t>) {
+                    visitRow(static_cast<vertex_t>(u), u, visitor);
+                } else {
+                    visitRow(static_cast<vertex_t>(u), 0, visitor);
+                }
+            }
+        }
+
+        /**
+         * @throws std::out_of_range if an endpoint isn't a vertex of the graph
+         */
+        void addEdge(vertex_t u, vertex_t v, edge_props_t props) override {
+            checkVertexRange(u, v);
+            setEdge(u, v, props);
+            if constexpr (has_prop<Undirected, edge_props_t>) {
+                setEdge(v, u, props);
+            }
+        }
+
+        void removeEdge(vertex_t u, vertex_t v) override {
+            if (!isVertexInRange(u) || !isVertexInRange(v)) {
+                return;
+            }
+            wordAt(u, v) &= ~bitMask(v);
+            if constexpr (has_prop<Undirected, edge_props_t>) {
+                wordAt(v, u) &= ~bitMask(u);
+            }
+        }
+
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            return MemoryUsage()
+                    .add("adjacency bits", vectorMemory(bits_))
+                    .add("props", vectorMemory(props_));
+        }
+
+        [[nodiscard]]
+        std::size_t vertexCount() const noexcept {
+            return vertex_count_;
+        }
+
+        /**
+         * @return number of vertices adjacent to u
+         */
+        [[nodiscard]]
+        std::size_t degree(vertex_t u) const noexcept {
+            if (!isVertexInRange(u)) {
+                return 0;
+            }
+            std::size_t res = 0;
+            for (std::size_t w = 0; w < words_per_row_; w++) {
+                res += std::popcount(bits_[static_cast<std::size_t>(u) * words_per_row_ + w]);
+            }
+            return res;
+        }
+
+    private:
+        bool isVertexInRange(vertex_t u) const noexcept {
+            return 0 <= u && static_cast<std::size_t>(u) < vertex_count_;
+        }
+
+        void checkVertexRange(vertex_t u, vertex_t v) const {
+            if (!isVertexInRange(u) || !isVertexInRange(v)) {
+                throw std::out_of_range("vertex number is out of range");
+            }
+        }
+
+        static word_t bitMask(vertex_t v) noexcept {
+            return word_t{1} << (static_cast<std::size_t>(v) % WORD_BITS);
+        }
+
+        word_t& wordAt(vertex_t u, vertex_t v) noexcept {
+            return bits_[static_cast<std::size_t>(u) * words_per_row_ + static_cast<std::size_t>(v) / WORD_BITS];
+        }
+
+        bool testBit(vertex_t u, vertex_t v) const noexcept {
+            return bits_[static_cast<std::size_t>(u) * words_per_row_ + static_cast<std::size_t>(v) / WORD_BITS] & bitMask(v);
+        }
+
+        edge_props_t propsAt(vertex_t u, vertex_t v) const noexcept {
+            if constexpr (HAS_PROPS) {
+                return props_[static_cast<std::size_t>(u) * vertex_count_ + static_cast<std::size_t>(v)].unpack();
+            } else {
+                return {};
+            }
+        }
+
+        void setEdge(vertex_t u, vertex_t v, edge_props_t props) {
+            wordAt(u, v) |= bitMask(v);
+            if constexpr (HAS_PROPS) {
+                props_[static_cast<std::size_t>(u) * vertex_count_ + static_cast<std::size_t>(v)] = packed_props_t::pack(props);
+            }
+        }
+
+        // visits neighbours v >= from of u
+        void visitRow(vertex_t u, std::size_t from, const Visitor& visitor) const {
+            const word_t* row = bits_.data() + static_cast<std::size_t>(u) * words_per_row_;
+            for (std::size_t w = from / WORD_BITS; w < words_per_row_; w++) {
+                word_t word = row[w];
+                if (w == from / WORD_BITS) {
+                    word &= ~word_t{0} << (from % WORD_BITS);
+                }
+                for (; word != 0; word &= word - 1) {
+                    auto v = static_cast<vertex_t>(w * WORD_BITS + std::countr_zero(word));
+                    visitor(u, v, propsAt(u, v));
+                }
+            }
+        }
+
+        std::size_t vertex_count_;
+        std::size_t words_per_row_;
+        std::vector<word_t> bits_;
+        std::vector<packed_props_t> props_{};
+    };
+}
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <ctpl/graph/EdgeKey.h>
+#include <ctpl/graph/IGraph.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Maximum flow / minimum s-t cut with unit edge capacities (Dinic), i.e. the number of edges that
+     * must be banned to disconnect the target from the source. The flow network is a snapshot of the graph:
+     * removeEdge() updates the current flow instead of recomputing it, later changes of the graph itself
+     * aren't tracked
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class MinCut {
+        static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t UNLIMITED = std::numeric_limits<std::size_t>::max();
+        using edge_key_t = EdgeKey<vertex_t>;
+
+        // arcs 2i and 2i + 1 are the residual pair of the i-th edge
+        struct Arc {
+            std::size_t to;
+            std::size_t capacity;
+            std::size_t residual;
+        };
+    public:
+        MinCut(const IGraph<vertex_t, edge_props_t>& graph, vertex_t source, vertex_t target) {
+            source_ = index(source);
+            target_ = index(target);
+            graph.visitAllEdges([&](vertex_t u, vertex_t v, edge_props_t) {
+                if (u == v || edge_arcs_.contains(edgeKey<edge_props_t>(u, v))) {
+                    return;
+                }
+                edge_arcs_[edgeKey<edge_props_t>(u, v)] = arcs_.size();
+                arcs_.push_back({index(v), 1, 1});
+                std::size_t back_capacity = has_prop<Undirected, edge_props_t> ? 1 : 0;
+                arcs_.push_back({index(u), back_capacity, back_capacity});
+            });
+
+            offsets_.assign(vertices_.size() + 1, 0);
+            for (std::size_t a = 0; a < arcs_.size(); a++) {
+                ++offsets_[tail(a) + 1];
+            }
+            std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+            adjacent_arcs_.resize(arcs_.size());
+            std::vector<std::size_t> fill(offsets_.begin(), offsets_.end() - 1);
+            for (std::size_t a = 0; a < arcs_.size(); a++) {
+                adjacent_arcs_[fill[tail(a)]++] = a;
+            }
+
+            if (source_ != target_) {
+                value_ = augment(source_, target_, UNLIMITED);
+            }
+        }
+
+        /**
+         * @return size of the minimum cut, the number of edge disjoint paths from the source to the target
+         */
+        [[nodiscard]]
+        std::size_t value() const noexcept {
+            return value_;
+        }
+
+        /**
+         * @return edges of a minimum cut, the one closest to the source
+         */
+        [[nodiscard]]
+        std::vector<std::pair<vertex_t, vertex_t>> cutEdges() const {
+            std::vector<bool> reachable = reachableFromSource();
+            std::vector<std::pair<vertex_t, vertex_t>> res;
+            for (const auto& [e, a] : edge_arcs_) {
+                std::size_t u = tail(a);
+                std::size_t v = arcs_[a].to;
+                if (reachable[u] != reachable[v] && (reachable[u] || has_prop<Undirected, edge_props_t>)) {
+                    res.push_back(e);
+                }
+            }
+            std::sort(res.begin(), res.end());
+            return res;
+        }
+
+        /**
+         * @return whether the vertex is on the source side of the cut returned by cutEdges()
+         */
+        [[nodiscard]]
+        bool isOnSourceSide(vertex_t u) const {
+            auto it = vertex_index_.find(u);
+            return it != vertex_index_.end() && reachableFromSource()[it->second];
+        }
+
+        /**
+         * @brief Removes the edge from the flow network, flow through it is rerouted if possible
+         * and the flow is augmented back to a maximum one
+         * @return whether the edge was in the network
+         */
+        bool removeEdge(vertex_t u, vertex_t v) {
+            auto it = edge_arcs_.find(edgeKey<edge_props_t>(u, v));
+            if (it == edge_arcs_.end()) {
+                return false;
+            }
+            std::size_t a = it->second;
+            edge_arcs_.erase(it);
+
+            // flow through the edge leaves an excess at its tail and a deficit at its head
+            std::size_t from = tail(a);
+            std::size_t to = arcs_[a].to;
+            std::size_t flow = arcs_[a].capacity - arcs_[a].residual;
+            if (arcs_[a].residual > arcs_[a].capacity) {
+                std::swap(from, to);
+                flow = arcs_[a].residual - arcs_[a].capacity;
+            }
+            arcs_[a] = {arcs_[a].to, 0, 0};
+            arcs_[a ^ 1] = {arcs_[a ^ 1].to, 0, 0};
+            if (flow == 0 || source_ == target_) {
+                return true;
+            }
+
+            std::size_t cancelled = flow - augment(from, to, flow);
+            if (cancelled > 0) {
+                [[maybe_unused]] std::size_t returned = augment(from, source_, cancelled);
+                [[maybe_unused]] std::size_t taken = augment(target_, to, cancelled);
+                CTPL_ASSERT(returned == cancelled && taken == cancelled, "flow decomposition is broken");
+                value_ -= cancelled;
+                value_ += augment(source_, target_, UNLIMITED);
+            }
+            return true;
+        }
+
+    private:
+        std::size_t index(vertex_t u) {
+            auto [it, inserted] = vertex_index_.emplace(u, vertices_.size());
+            if (inserted) {
+                vertices_.push_back(u);
+            }
+            return it->second;
+        }
+
+        std::size_t tail(std::size_t arc) const noexcept {
+            return arcs_[arc ^ 1].to;
+        }
+
+        std::vector<bool> reachableFromSource() const {
+            std::vector<bool> reachable(vertices_.size(), false);
+            std::vector<std::size_t> stack = {source_};
+            reachable[source_] = true;
+            while (!stack.empty()) {
+                std::size_t u = stack.back();
+                stack.pop_back();
+                for (std::size_t i = offsets_[u]; i < offsets_[u + 1]; i++) {
+                    const Arc& arc = arcs_[adjacent_arcs_[i]];
+                    if (arc.residual > 0 && !reachable[arc.to]) {
+                        reachable[arc.to] = true;
+                        stack.push_back(arc.to);
+                    }
+                }
+            }
+            return reachable;
+        }
+
+        // pushes at most limit units of flow from -> to along residual arcs, returns the pushed amount
+        std::size_t augment(std::size_t from, std::size_t to, std::size_t limit) {
+            if (from == to) {
+                return limit;
+            }
+            std::size_t pushed = 0;
+            while (pushed < limit && buildLevels(from, to)) {
+                current_.assign(offsets_.begin(), offsets_.end() - 1);
+                while (pushed < limit) {
+                    std::size_t f = findBlockingPath(from, to, limit - pushed);
+                    if (f == 0) {
+                        break;
+                    }
+                    pushed += f;
+                }
+            }
+            return pushed;
+        }
+
+        bool buildLevels(std::size_t from, std::size_t to) {
+            level_.assign(vertices_.size(), NONE);
+            std::queue<std::size_t> queue;
+            queue.push(from);
+            CTPL_STAT_INC(queue_pushes);
+            level_[from] = 0;
+            while (!queue.empty()) {
+                std::size_t u = queue.front();
+                queue.pop();
+                CTPL_STAT_INC(queue_pops);
+                for (std::size_t i = offsets_[u]; i < offsets_[u + 1]; i++) {
+                    CTPL_STAT_INC(edge_relaxations);
+                    const Arc& arc = arcs_[adjacent_arcs_[i]];
+                    if (arc.residual > 0 && level_[arc.to] == NONE) {
+                        level_[arc.to] = level_[u] + 1;
+                        queue.push(arc.to);
+                        CTPL_STAT_INC(queue_pushes);
+                    }
+                }
+            }
+            return level_[to] != NONE;
+        }
+
+        // finds a path in the level graph with the current arc pointers and saturates it
+        std::size_t findBlockingPath(std::size_t from, std::size_t to, std::size_t limit) {
+            path_.clear();
+            std::size_t u = from;
+            while (u != to) {
+                bool advanced = false;
+                for (; current_[u] < offsets_[u + 1]; ++current_[u]) {
+                    std::size_t a = adjacent_arcs_[current_[u]];
+                    if (arcs_[a].residual > 0 && level_[arcs_[a].to] == level_[u] + 1) {
+                        path_.push_back(a);
+                        u = arcs_[a].to;
+                        advanced = true;
+                        break;
+                    }
+                }
+                if (advanced) {
+                    continue;
+                }
+                // dead end, never visit it again in this phase
+                level_[u] = NONE;
+                if (path_.empty()) {
+                    return 0;
+                }
+                u = tail(path_.back());
+                path_.pop_back();
+                ++current_[u];
+            }
+
+            std::size_t bottleneck = limit;
+            for (std::size_t a : path_) {
+                bottleneck = std::min(bottleneck, arcs_[a].residual);
+            }
+            for (std::size_t a : path_) {
+                arcs_[a].residual -= bottleneck;
+                arcs_[a ^ 1].residual += bottleneck;
+            }
+            return bottleneck;
+        }
+
+        std::unordered_map<vertex_t, std::size_t> vertex_index_{};
+        std::vector<vertex_t> vertices_{};
+        std::unordered_map<edge_key_t, std::size_t, EdgeKeyHash<vertex_t>> edge_arcs_{};
+        std::vector<Arc> arcs_{};
+        std::vector<std::size_t> offsets_{};
+        std::vector<std::size_t> adjacent_arcs_{};
+        std::size_t source_;
+        std::size_t target_;
+        std::size_t value_ = 0;
+
+        // scratch space of augment()
+        std::vector<std::size_t> level_{};
+        std::vector<std::size_t> current_{};
+        std::vector<std::size_t> path_{};
+    };
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <ctpl/graph/IDynamicGraph.h>
+#include <ctpl/graph/Builder.h>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace ctpl {
+    /**
+     * @brief Persistent dynamic graph: adjacency is a path-copying treap keyed by (u, v), nodes are immutable
+     * and shared between versions. Copying the graph (or snapshot()) is O(1), a mutation copies O(log m) nodes,
+     * so memory grows with the number of edits made after branching, not with the number of branches.
+     * Priorities are a hash of the key, so the tree shape depends only on the edge set
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class PersistentGraph : public IDynamicGraph<vertex_t, edge_props_t> {
+        using Visitor = IGraph<vertex_t, edge_props_t>::Visitor;
+        using packed_props_t = PackedProps<edge_props_t>;
+        using key_t = std::pair<vertex_t, vertex_t>;
+        template<typename builder_self_t>
+        using Builder = GraphBuilder<vertex_t, edge_props_t, builder_self_t>;
+
+        struct Node;
+        using node_ptr = std::shared_ptr<const Node>;
+
+        struct Node {
+            key_t key;
+            std::uint64_t priority;
+            [[no_unique_address]] packed_props_t props;
+            node_ptr left;
+            node_ptr right;
+        };
+    public:
+        PersistentGraph() = default;
+
+        template<typename builder_self_t>
+        PersistentGraph(const Builder<builder_self_t>& builder) { // NOLINT
+            for (const Edge<vertex_t, edge_props_t>& e : builder.edges()) {
+                addEdge(e.u, e.v, e);
+            }
+        }
+
+        /**
+         * @return independent version of the graph sharing all structure with this one, O(1)
+         */
+        [[nodiscard]]
+        PersistentGraph snapshot() const {
+            return *this;
+        }
+
+        bool isEdgeBelongs(vertex_t u, vertex_t v) const override {
+            return find({u, v}) != nullptr;
+        }
+
+        std::optional<edge_props_t> getEdgeProps(vertex_t u, vertex_t v) const override {
+            if (const Node* node = find({u, v})) {
+                return node->props.unpack();
+            }
+            return std::nullopt;
+        }
+
+        void visitAdjacentVertices(vertex_t vertex, const Visitor& visitor) const override {
+            visitRange(root_.get(), vertex, visitor);
+        }
+
+        void visitAllEdges(const Visitor& visitor) const override {
+            visitAll(root_.get(), visitor);
+        }
+
+        void addEdge(vertex_t u, vertex_t v, edge_props_t props) override {
+            auto packed = packed_props_t::pack(props);
+            root_ = insert(root_, {u, v}, packed);
+            if constexpr (has_prop<Undirected, edge_props_t>) {
+                root_ = insert(root_, {v, u}, packed);
+            }
+        }
+
+        void removeEdge(vertex_t u, vertex_t v) override {
+            root_ = erase(root_, {u, v});
+            if constexpr (has_prop<Undirected, edge_props_t>) {
+                root_ = erase(root_, {v, u});
+            }
+        }
+
+        /**
+         * @brief Nodes are shared between versions, so footprints of different versions don't add up
+         * @return footprint of the nodes reachable from this version, O(m)
+         */
+        [[nodiscard]]
+        MemoryUsage memoryUsage() const override {
+            // make_shared keeps the node and its control block (two counters and a vtable) in one allocation
+            static constexpr std::size_t NODE_SIZE = sizeof(Node) + 2 * sizeof(long) + sizeof(void*);
+            return MemoryUsage().add("treap nodes", countNodes(root_.get()) * NODE_SIZE);
+        }
+
+        /**
+         * @return whether both graphs are the same version (share the root), O(1)
+         */
+        [[nodiscard]]
+        bool sharesStructureWith(const PersistentGraph& other) const noexcept {
+            return root_ == other.root_;
+        }
+
+    private:
+        static std::uint64_t priorityOf(const key_t& key) noexcept {
+            std::uint64_t x = static_cast<std::uint64_t>(key.first) * 0x9e3779b97f4a7c15ULL ^ static_cast<std::uint64_t>(key.second);
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+        static std::size_t countNodes(const Node* node) noexcept {
+            std::size_t res = 0;
+            while (node != nullptr) {
+                res += 1 + countNodes(node->left.get());
+                node = node->right.get();
+            }
+            return res;
+        }
+
+        static node_ptr makeNode(const key_t& key, std::uint64_t priority, packed_props_t props, node_ptr left, node_ptr right) {
+            return std::make_shared<const Node>(Node{key, priority, props, std::move(left), std::move(right)});
+        }
+
+        static node_ptr withChildren(const Node& node, node_ptr left, node_ptr right) {
+            return makeNode(node.key, node.priority, node.props, std::move(left), std::move(right));
+        }
+
+        const Node* find(const key_t& key) const noexcept {
+            const Node* node = root_.get();
+            while (node != nullptr && node->key != key) {
+                node = key < node->key ? node->left.get() : node->right.get();
+            }
+            return node;
+        }
+
+        static node_ptr insert(const node_ptr& node, const key_t& key, packed_props_t props) {
+            if (!node) {
+                return makeNode(key, priorityOf(key), props, nullptr, nullptr);
+            }
+            if (key == node->key) {
+                return makeNode(key, node->priority, props, node->left, node->right);
+            }
+            if (key < node->key) {
+                node_ptr left = insert(node->left, key, props);
+                if (left->priority > node->priority) {
+                    // rotate right
+                    return withChildren(*left, left->left, withChildren(*node, left->right, node->right));
+                }
+                return withChildren(*node, std::move(left), node->right);
+            }
+            node_ptr right = insert(node->right, key, props);
+            if (right->priority > node->priority) {
+                // rotate left
+                return withChildren(*right, withChildren(*node, node->left, right->left), right->right);
+            }
+            return withChildren(*node, node->left, std::move(right));
+        }
+
+        // returns the same pointer if there is nothing to erase, so untouched versions stay shared
+        static node_ptr erase(const node_ptr& node, const key_t& key) {
+            if (!node) {
+                return node;
+            }
+            if (key == node->key) {
+                return merge(node->left, node->right);
+            }
+            if (key < node->key) {
+                node_ptr left = erase(node->left, key);
+                return left == node->left ? node : withChildren(*node, std::move(left), node->right);
+            }
+            node_ptr right = erase(node->right, key);
+            return right == node->right ? node : withChildren(*node, node->left, std::move(right));
+        }
+
+        // all keys of lhs are less than all keys of rhs
+        static node_ptr merge(const node_ptr& lhs, const node_ptr& rhs) {
+            if (!lhs) {
+                return rhs;
+            }
+            if (!rhs) {
+                return lhs;
+            }
+            if (lhs->priority > rhs->priority) {
+                return withChildren(*lhs, lhs->left, merge(lhs->right, rhs));
+            }
+            return withChildren(*rhs, merge(lhs, rhs->left), rhs->right);
+        }
+
+        // in-order visit of keys (u, *)
+        static void visitRange(const Node* node, vertex_t u, const Visitor& visitor) {
+            while (node != nullptr) {
+                if (node->key.first < u) {
+                    node = node->right.get();
+                } else if (u < node->key.first) {
+                    node = node->left.get();
+                } else {
+                    visitRange(node->left.get(), u, visitor);
+                    visitor(u, node->key.second, node->props.unpack());
+                    node = node->right.get();
+                }
+            }
+        }
+
+        static void visitAll(const Node* node, const Visitor& visitor) {
+            while (node != nullptr) {
+                visitAll(node->left.get(), visitor);
+                auto [u, v] = node->key;
+                if constexpr (has_prop<Undirected, edge_props_t>) {
+                    if (u <= v) {
+                        visitor(u, v, node->props.unpack());
+                    }
+                } else {
+                    visitor(u, v, node->props.unpack());
+                }
+                node = node->right.get();
+            }
+        }
+
+        node_ptr root_{};
+    };
+}
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <ctpl/graph/Builder.h>
+#include <ctpl/util/assert.h>
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Bijection between original vertex ids and ids after reordering, both over [0, size())
+     */
+    template<typename vertex_t>
+    class Permutation {
+    public:
+        Permutation() = default;
+
+        /**
+         * @param order original ids in their new order, i.e. order[i] gets the new id i
+         */
+        explicit Permutation(std::vector<vertex_t> order) : new_to_old_(std::move(order)) {
+            old_to_new_.resize(new_to_old_.size());
+            for (std::size_t i = 0; i < new_to_old_.size(); i++) {
+                CTPL_ASSERT(0 <= new_to_old_[i] && static_cast<std::size_t>(new_to_old_[i]) < size(),
+                            "vertex number is out of range");
+                old_to_new_[new_to_old_[i]] = static_cast<vertex_t>(i);
+            }
+        }
+
+        static Permutation identity(std::size_t size) {
+            std::vector<vertex_t> order(size);
+            std::iota(order.begin(), order.end(), vertex_t{0});
+            return Permutation(std::move(order));
+        }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept {
+            return new_to_old_.size();
+        }
+
+        [[nodiscard]]
+        vertex_t toNew(vertex_t u) const noexcept {
+            return old_to_new_[u];
+        }
+
+        [[nodiscard]]
+        vertex_t toOld(vertex_t u) const noexcept {
+            return new_to_old_[u];
+        }
+
+        /**
+         * @brief Translates a path (or any vertex sequence) found in the reordered graph back to original ids
+         */
+        [[nodiscard]]
+        std::vector<vertex_t> toOld(std::span<const vertex_t> vertices) const {
+            std::vector<vertex_t> res(vertices.size());
+            std::transform(vertices.begin(), vertices.end(), res.begin(), [this](vertex_t u) {
+                return toOld(u);
+            });
+            return res;
+        }
+
+        [[nodiscard]]
+        std::vector<vertex_t> toNew(std::span<const vertex_t> vertices) const {
+            std::vector<vertex_t> res(vertices.size());
+            std::transform(vertices.begin(), vertices.end(), res.begin(), [this](vertex_t u) {
+                return toNew(u);
+            });
+            return res;
+        }
+
+        [[nodiscard]]
+        const std::vector<vertex_t>& order() const noexcept {
+            return new_to_old_;
+        }
+
+        bool operator==(const Permutation&) const = default;
+
+    private:
+        std::vector<vertex_t> old_to_new_{};
+        std::vector<vertex_t> new_to_old_{};
+    };
+
+    enum class VertexOrder {
+        // ids are kept
+        IDENTITY,
+        // breadth-first search order from the lowest unvisited id of every component
+        BFS,
+        // reverse Cuthill-McKee: BFS from a pseudo-peripheral vertex visiting neighbours by increasing degree,
+        // reversed, keeps the bandwidth of the adjacency matrix small
+        REVERSE_CUTHILL_MCKEE,
+        // recursive BFS-level separators, every separator follows both parts it separates,
+        // a contraction order for CustomizableContractionHierarchy
+        NESTED_DISSECTION
+    };
+
+    namespace detail {
+        // symmetric CSR adjacency of the builder edges, edge directions don't matter for locality
+        template<typename vertex_t>
+        struct ReorderAdjacency {
+            std::vector<std::size_t> offsets;
+            std::vector<vertex_t> targets;
+
+            std::span<const vertex_t> adjacent(std::size_t u) const noexcept {
+                return {targets.data() + offsets[u], targets.data() + offsets[u + 1]};
+            }
+
+            std::size_t degree(std::size_t u) const noexcept {
+                return offsets[u + 1] - offsets[u];
+            }
+
+            std::size_t vertexCount() const noexcept {
+                return offsets.size() - 1;
+            }
+        };
+
+        template<typename vertex_t, typename edge_props_t, typename self_t>
+        ReorderAdjacency<vertex_t> reorderAdjacency(const GraphBuilder<vertex_t, edge_props_t, self_t>& builder) {
+            ReorderAdjacency<vertex_t> adj;
+            adj.offsets.assign(builder.deducedVertexCount() + 1, 0);
+            for (const auto& e : builder.edges()) {
+                ++adj.offsets[e.u + 1];
+                ++adj.offsets[e.v + 1];
+            }
+            std::partial_sum(adj.offsets.begin(), adj.offsets.end(), adj.offsets.begin());
+            adj.targets.resize(adj.offsets.back());
+            std::vector<std::size_t> fill(adj.offsets.begin(), adj.offsets.end() - 1);
+            for (const auto& e : builder.edges()) {
+                adj.targets[fill[e.u]++] = e.v;
+                adj.targets[fill[e.v]++] = e.u;
+            }
+            for (std::size_t u = 0; u < adj.vertexCount(); u++) {
+                auto begin = adj.targets.begin() + adj.offsets[u];
+                auto end = adj.targets.begin() + adj.offsets[u + 1];
+                std::sort(begin, end);
+            }
+            return adj;
+        }
+
+        // appends the component of start to order in BFS order, neighbours are visited in the given order
+        template<typename vertex_t, typename Less>
+        void appendBfs(const ReorderAdjacency<vertex_t>& adj, vertex_t start, std::vector<bool>& visited,
+                       std::vector<vertex_t>& order, Less less) {
+            std::size_t head = order.size();
+            order.push_back(start);
+            visited[start] = true;
+            std::vector<vertex_t> next;
+            for (; head < order.size(); head++) {
+                next.clear();
+                for (vertex_t v : adj.adjacent(order[head])) {
+                    if (!visited[v]) {
+                        visited[v] = true;
+                        next.push_back(v);
+                    }
+                }
+                std::stable_sort(next.begin(), next.end(), less);
+                order.insert(order.end(), next.begin(), next.end());
+            }
+        }
+
+        inline constexpr std::size_t NO_LEVEL = -1;
+
+        /*
+         * George-Liu heuristic: restart BFS from a min degree vertex of the last level while the depth grows.
+         * level is scratch space of vertexCount() NO_LEVEL entries and is restored on return
+         */
+        template<typename vertex_t>
+        vertex_t pseudoPeripheralVertex(const ReorderAdjacency<vertex_t>& adj, vertex_t start,
+                                        std::vector<std::size_t>& level) {
+            std::vector<vertex_t> touched;
+            auto reset = [&]() {
+                for (vertex_t u : touched) {
+                    level[u] = NO_LEVEL;
+                }
+            };
+            auto eccentricity = [&](vertex_t root, vertex_t& farthest) {
+                reset();
+                touched = {root};
+                level[root] = 0;
+                for (std::size_t head = 0; head < touched.size(); head++) {
+                    for (vertex_t v : adj.adjacent(touched[head])) {
+                        if (level[v] == NO_LEVEL) {
+                            level[v] = level[touched[head]] + 1;
+                            touched.push_back(v);
+                        }
+                    }
+                }
+                std::size_t depth = level[touched.back()];
+                farthest = touched.back();
+                for (vertex_t u : touched) {
+                    if (level[u] == depth && adj.degree(u) < adj.degree(farthest)) {
+                        farthest = u;
+                    }
+                }
+                return depth;
+            };
+
+            vertex_t candidate;
+            std::size_t depth = eccentricity(start, candidate);
+            while (true) {
+                vertex_t next;
+                std::size_t next_depth = eccentricity(candidate, next);
+                if (next_depth <= depth) {
+                    reset();
+                    return candidate;
+                }
+                depth = next_depth;
+                std::swap(candidate, next);
+            }
+        }
+        /*
+         * Splits every component at the middle BFS level counted from a far vertex, the level becomes
+         * the separator and the levels above and below it are split recursively
+         */
+        template<typename vertex_t>
+        std::vector<vertex_t> nestedDissectionOrder(const ReorderAdjacency<vertex_t>& adj) {
+            // parts this small are ordered arbitrarily
+            static constexpr std::size_t LEAF_SIZE = 2;
+
+            std::size_t n = adj.vertexCount();
+            // id of the part a vertex belongs to, 0 once the vertex is ordered
+            std::vector<std::size_t> owner(n, 0);
+            std::vector<std::size_t> level(n, NO_LEVEL);
+            std::size_t next_id = 1;
+            auto bfs = [&](vertex_t root, std::size_t id, std::vector<vertex_t>& out) {
+                out = {root};
+                level[root] = 0;
+                for (std::size_t head = 0; head < out.size(); head++) {
+                    for (vertex_t v : adj.adjacent(out[head])) {
+                        if (owner[v] == id && level[v] == NO_LEVEL) {
+                            level[v] = level[out[head]] + 1;
+                            out.push_back(v);
+                        }
+                    }
+                }
+            };
+            auto clearLevels = [&](const std::vector<vertex_t>& vertices) {
+                for (vertex_t u : vertices) {
+                    level[u] = NO_LEVEL;
+                }
+            };
+
+            // separators are collected top-down and reversed at the end
+            std::vector<vertex_t> order;
+            order.reserve(n);
+            std::vector<std::vector<vertex_t>> parts(1, std::vector<vertex_t>(n));
+            std::iota(parts[0].begin(), parts[0].end(), vertex_t{0});
+            std::vector<vertex_t> component, sweep;
+            while (!parts.empty()) {
+                std::vector<vertex_t> part = std::move(parts.back());
+                parts.pop_back();
+                std::size_t id = next_id++;
+                for (vertex_t u : part) {
+                    owner[u] = id;
+                }
+                for (vertex_t root : part) {
+                    if (owner[root] != id) {
+                        continue;
+                    }
+                    bfs(root, id, component);
+                    clearLevels(component);
+                    if (component.size() > LEAF_SIZE) {
+                        // the last vertex of a BFS order is far from the others
+                        bfs(component.back(), id, sweep);
+                        // the separator is the smallest level overlapping the middle third of the BFS order
+                        std::size_t middle = 0;
+                        std::size_t middle_size = NO_LEVEL;
+                        for (std::size_t begin = 0, end = 0; begin < sweep.size(); begin = end) {
+                            while (end < sweep.size() && level[sweep[end]] == level[sweep[begin]]) {
+                                ++end;
+                            }
+                            if (3 * end > sweep.size() && 3 * begin < 2 * sweep.size() && end - begin < middle_size) {
+                                middle = level[sweep[begin]];
+                                middle_size = end - begin;
+                            }
+                        }
+                        std::vector<vertex_t> lower, upper;
+                        for (vertex_t u : sweep) {
+                            if (level[u] == middle) {
+                                order.push_back(u);
+                            } else {
+                                (level[u] < middle ? lower : upper).push_back(u);
+                            }
+                        }
+                        clearLevels(sweep);
+                        for (auto* side : {&lower, &upper}) {
+                            if (!side->empty()) {
+                                parts.push_back(std::move(*side));
+                            }
+                        }
+                    } else {
+                        order.insert(order.end(), component.begin(), component.end());
+                    }
+                    for (vertex_t u : component) {
+                        owner[u] = 0;
+                    }
+                }
+            }
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+    }
+
+    /**
+     * @brief Vertex order improving memory locality of traversals, vertices must be numbered from 0
+     * (as for IndexedGraph). Apply it with reordered(builder, permutation) and keep the permutation
+     * to translate ids of queries and results
+     */
+    template<typename vertex_t, typename edge_props_t, typename self_t>
+    Permutation<vertex_t> vertexOrder(const GraphBuilder<vertex_t, edge_props_t, self_t>& builder, VertexOrder kind) {
+        if (kind == VertexOrder::IDENTITY) {
+            return Permutation<vertex_t>::identity(builder.deducedVertexCount());
+        }
+
+        auto adj = detail::reorderAdjacency(builder);
+        if (kind == VertexOrder::NESTED_DISSECTION) {
+            return Permutation<vertex_t>(detail::nestedDissectionOrder(adj));
+        }
+        std::vector<bool> visited(adj.vertexCount(), false);
+        std::vector<std::size_t> level(kind == VertexOrder::REVERSE_CUTHILL_MCKEE ? adj.vertexCount() : 0,
+                                       detail::NO_LEVEL);
+        std::vector<vertex_t> order;
+        order.reserve(adj.vertexCount());
+        for (std::size_t u = 0; u < adj.vertexCount(); u++) {
+            if (visited[u]) {
+                continue;
+            }
+            if (kind == VertexOrder::BFS) {
+                detail::appendBfs(adj, static_cast<vertex_t>(u), visited, order, std::less<vertex_t>());
+            } else {
+                vertex_t start = detail::pseudoPeripheralVertex(adj, static_cast<vertex_t>(u), level);
+                std::size_t component_begin = order.size();
+                detail::appendBfs(adj, start, visited, order, [&](vertex_t a, vertex_t b) {
+                    return adj.degree(a) < adj.degree(b);
+                });
+                std::reverse(order.begin() + component_begin, order.end());
+            }
+        }
+        return Permutation<vertex_t>(std::move(order));
+    }
+
+    /**
+     * @brief Copy of the builder with vertex u renamed to permutation.toNew(u), edge order and props are kept
+     */
+    template<typename vertex_t, typename edge_props_t, typename self_t>
+    GraphBuilder<vertex_t, edge_props_t> reordered(const GraphBuilder<vertex_t, edge_props_t, self_t>& builder,
+                                                   const Permutation<vertex_t>& permutation) {
+        GraphBuilder<vertex_t, edge_props_t> res;
+        res.withVertexCount(permutation.size());
+        res.reserveEdges(builder.edges().size());
+        for (const auto& e : builder.edges()) {
+            res.withEdge(permutation.toNew(e.u), permutation.toNew(e.v), e);
+        }
+        return res;
+    }
+}
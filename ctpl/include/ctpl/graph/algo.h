@@ -1,7 +1,14 @@
 #pragma once
 
 #include <ctpl/graph/IGraph.h>
+#include <ctpl/graph/queues.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
+#include <algorithm>
 #include <concepts>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <limits>
 #include <optional>
 #include <queue>
@@ -12,6 +19,23 @@
 
 namespace ctpl {
 
+    /**
+     * @brief Type of path lengths: the weight type for weighted graphs, number of edges for unweighted ones
+     */
+    template<typename edge_props_t>
+    using distance_t = std::conditional_t<IsPropsWeighted<edge_props_t>::value,
+                                          typename IsPropsWeighted<edge_props_t>::underlying_type,
+                                          std::size_t>;
+
+    template<typename edge_props_t>
+    constexpr distance_t<edge_props_t> edgeLength(const edge_props_t &props) {
+        if constexpr (IsPropsWeighted<edge_props_t>::value) {
+            return static_cast<const Weighted<distance_t<edge_props_t>> &>(props).weight;
+        } else {
+            return 1;
+        }
+    }
+
     template<
             typename vertex_t,
             typename edge_props_t,
@@ -23,17 +47,22 @@ namespace ctpl {
                    Visitor &&visitor, IsVisitedCallback &&is_visited, SetVisitedCallback &&set_visited) {
         std::stack<vertex_t> stack;
         stack.push(initialVertex);
+        CTPL_STAT_INC(queue_pushes);
         set_visited(initialVertex, initialVertex);
 
         while (!stack.empty()) {
             auto u = stack.top();
             stack.pop();
+            CTPL_STAT_INC(queue_pops);
+            CTPL_STAT_INC(settled_vertices);
             visitor(u);
             graph.visitAdjacentVertices(u, [&](vertex_t, vertex_t v, edge_props_t) {
+                CTPL_STAT_INC(edge_relaxations);
                 if (is_visited(v)) {
                     return true;
                 }
                 stack.push(v);
+                CTPL_STAT_INC(queue_pushes);
                 set_visited(u, v);
                 return true;
             });
@@ -51,24 +80,33 @@ namespace ctpl {
                    Visitor &&visitor, IsVisitedCallback &&isVisited, SetVisitedCallback &&setVisited) {
         std::queue<vertex_t> stack;
         stack.push(initialVertex);
+        CTPL_STAT_INC(queue_pushes);
         setVisited(initialVertex, initialVertex);
 
         while (!stack.empty()) {
-            auto u = stack.top();
+            auto u = stack.front();
             stack.pop();
+            CTPL_STAT_INC(queue_pops);
+            CTPL_STAT_INC(settled_vertices);
             visitor(u);
             graph.visitAdjacentVertices(u, [&](vertex_t, vertex_t v, edge_props_t) {
+                CTPL_STAT_INC(edge_relaxations);
                 if (isVisited(v)) {
                     return true;
                 }
                 stack.push(v);
+                CTPL_STAT_INC(queue_pushes);
                 setVisited(u, v);
                 return true;
             });
         }
     }
 
+    /**
+     * @brief Dijkstra parametrized by the priority queue, see queues.h for the available policies
+     */
     template<
+            template<typename, typename> class Queue = BinaryHeapQueue,
             typename vertex_t,
             typename edge_props_t,
             std::invocable<vertex_t> IsVisitedCallback,
@@ -82,42 +120,340 @@ namespace ctpl {
         struct PQVertex {
             vertex_t u;
             vertex_t v;
-            weight_t dist;
-
-            auto operator<=>(const PQVertex &other) const {
-                return dist <=> other.dist;
-            }
         };
 
-        std::priority_queue<PQVertex, std::vector<PQVertex>, std::greater<PQVertex>> pq;
-        pq.push({
-                        .u = initial_vertex,
-                        .v = initial_vertex,
-                        .dist = 0
-                });
+        Queue<weight_t, PQVertex> pq;
+        pq.push(0, {
+                .u = initial_vertex,
+                .v = initial_vertex
+        });
+        CTPL_STAT_INC(queue_pushes);
 
         while (!pq.empty()) {
-            auto [u, v, dist] = pq.top();
-            pq.pop();
+            auto [dist, top] = pq.pop();
+            CTPL_STAT_INC(queue_pops);
+            auto [u, v] = top;
             if (is_visited(v)) {
+                CTPL_STAT_INC(stale_pops);
                 continue;
             }
 
+            CTPL_STAT_INC(settled_vertices);
             set_visited(u, v);
             set_dist(v, dist);
             graph.visitAdjacentVertices(v, [&](vertex_t u1, vertex_t v1, Weighted<weight_t> w) {
+                CTPL_STAT_INC(edge_relaxations);
                 if (is_visited(v1)) {
                     return;
                 }
-                pq.push({
-                                .u = u1,
-                                .v = v1,
-                                .dist = dist + w.weight
-                        });
+                CTPL_STAT_INC(queue_pushes);
+                pq.push(dist + w.weight, {
+                        .u = u1,
+                        .v = v1
+                });
+            });
+        }
+    }
+
+    template<
+            typename vertex_t,
+            typename edge_props_t,
+            std::invocable<vertex_t> IsVisitedCallback,
+            std::invocable<vertex_t, vertex_t> SetVisitedCallback,
+            std::invocable<vertex_t, distance_t<edge_props_t>> SetDistCallback
+    >
+    void bfsDistancesCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex,
+                            IsVisitedCallback &&is_visited, SetVisitedCallback &&set_visited, SetDistCallback &&set_dist) {
+        using dist_t = distance_t<edge_props_t>;
+        std::queue<std::pair<vertex_t, dist_t>> queue;
+        queue.push({initial_vertex, 0});
+        CTPL_STAT_INC(queue_pushes);
+        set_visited(initial_vertex, initial_vertex);
+        set_dist(initial_vertex, 0);
+
+        while (!queue.empty()) {
+            auto [u, dist] = queue.front();
+            queue.pop();
+            CTPL_STAT_INC(queue_pops);
+            CTPL_STAT_INC(settled_vertices);
+            graph.visitAdjacentVertices(u, [&](vertex_t, vertex_t v, edge_props_t) {
+                CTPL_STAT_INC(edge_relaxations);
+                if (is_visited(v)) {
+                    return;
+                }
+                set_visited(u, v);
+                set_dist(v, dist + 1);
+                queue.push({v, dist + 1});
+                CTPL_STAT_INC(queue_pushes);
             });
         }
     }
 
+    template<
+            typename vertex_t,
+            typename edge_props_t,
+            std::invocable<vertex_t> IsVisitedCallback,
+            std::invocable<vertex_t, vertex_t> SetVisitedCallback,
+            std::invocable<vertex_t, distance_t<edge_props_t>> SetDistCallback
+    >
+    void zeroOneBfsCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex,
+                          IsVisitedCallback &&is_visited, SetVisitedCallback &&set_visited, SetDistCallback &&set_dist) {
+        using dist_t = distance_t<edge_props_t>;
+        struct DequeVertex {
+            vertex_t u;
+            vertex_t v;
+            dist_t dist;
+        };
+
+        std::deque<DequeVertex> deque;
+        deque.push_back({initial_vertex, initial_vertex, 0});
+        CTPL_STAT_INC(queue_pushes);
+
+        while (!deque.empty()) {
+            auto [u, v, dist] = deque.front();
+            deque.pop_front();
+            CTPL_STAT_INC(queue_pops);
+            if (is_visited(v)) {
+                CTPL_STAT_INC(stale_pops);
+                continue;
+            }
+
+            CTPL_STAT_INC(settled_vertices);
+            set_visited(u, v);
+            set_dist(v, dist);
+            graph.visitAdjacentVertices(v, [&](vertex_t u1, vertex_t v1, edge_props_t props) {
+                CTPL_STAT_INC(edge_relaxations);
+                if (is_visited(v1)) {
+                    return;
+                }
+                CTPL_STAT_INC(queue_pushes);
+                auto w = edgeLength(props);
+                CTPL_ASSERT(w == 0 || w == 1, "0-1 BFS is applicable only to 0/1 weights");
+                if (w == 0) {
+                    deque.push_front({u1, v1, dist});
+                } else {
+                    deque.push_back({u1, v1, dist + 1});
+                }
+            });
+        }
+    }
+
+    namespace detail {
+        // bucket queues with more buckets than that are slower than a binary heap
+        inline constexpr std::size_t DIAL_MAX_WEIGHT = 1 << 16;
+
+        template<typename edge_props_t>
+        constexpr std::size_t declaredMaxWeight() {
+            if constexpr (HasMaxWeight<edge_props_t>) {
+                return static_cast<std::size_t>(max_weight_of<edge_props_t>);
+            } else {
+                return std::numeric_limits<std::size_t>::max();
+            }
+        }
+    }
+
+    /**
+     * @brief Single source shortest paths, algorithm is chosen from the edge props at compile time:
+     * BFS for unweighted graphs, 0-1 BFS for integer MaxWeight<1>, Dijkstra with Dial's buckets for small integer
+     * MaxWeight, with a radix heap for other integer weights and with a binary heap otherwise
+     */
+    template<
+            typename vertex_t,
+            typename edge_props_t,
+            std::invocable<vertex_t> IsVisitedCallback,
+            std::invocable<vertex_t, vertex_t> SetVisitedCallback,
+            std::invocable<vertex_t, distance_t<edge_props_t>> SetDistCallback
+    >
+    void shortestPathsCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex,
+                             IsVisitedCallback &&is_visited, SetVisitedCallback &&set_visited, SetDistCallback &&set_dist) {
+        constexpr std::size_t max_weight = detail::declaredMaxWeight<edge_props_t>();
+        constexpr bool integral = std::is_integral_v<distance_t<edge_props_t>>;
+        if constexpr (!IsPropsWeighted<edge_props_t>::value) {
+            bfsDistancesCustom(graph, initial_vertex, is_visited, set_visited, set_dist);
+        } else if constexpr (integral && max_weight <= 1) {
+            zeroOneBfsCustom(graph, initial_vertex, is_visited, set_visited, set_dist);
+        } else if constexpr (integral && max_weight <= detail::DIAL_MAX_WEIGHT) {
+            dijkstraCustom<DialQueue>(graph, initial_vertex, is_visited, set_visited, set_dist);
+        } else if constexpr (integral) {
+            dijkstraCustom<RadixHeapQueue>(graph, initial_vertex, is_visited, set_visited, set_dist);
+        } else {
+            dijkstraCustom(graph, initial_vertex, is_visited, set_visited, set_dist);
+        }
+    }
+
+    namespace detail {
+        // queue of SearchWorkspace, chosen the same way as in shortestPathsCustom, unit lengths use buckets too
+        template<typename edge_props_t, typename value_t>
+        auto makeWorkspaceQueue() {
+            using dist_t = distance_t<edge_props_t>;
+            constexpr std::size_t max_weight = IsPropsWeighted<edge_props_t>::value ? declaredMaxWeight<edge_props_t>() : 1;
+            if constexpr (std::is_integral_v<dist_t> && max_weight <= DIAL_MAX_WEIGHT) {
+                return DialQueue<dist_t, value_t>(max_weight);
+            } else if constexpr (std::is_integral_v<dist_t>) {
+                return RadixHeapQueue<dist_t, value_t>();
+            } else {
+                return BinaryHeapQueue<dist_t, value_t>();
+            }
+        }
+    }
+
+    /**
+     * @brief Scratch space of single source searches kept by the caller between queries: per vertex
+     * distance / parent arrays are invalidated in O(1) by bumping a generation counter and the queue keeps
+     * its storage, so once the arrays have grown to the graph size queries don't allocate.
+     * Vertices are expected to be numbered from 0, the arrays are indexed by vertex id
+     */
+    template<typename vertex_t, typename edge_props_t>
+    class SearchWorkspace {
+        using dist_t = distance_t<edge_props_t>;
+
+        struct QueueEntry {
+            vertex_t parent;
+            vertex_t v;
+        };
+
+        struct NoSettleCallback {
+            void operator()(vertex_t, vertex_t, dist_t) const noexcept {
+            }
+        };
+    public:
+        /**
+         * @brief Settles vertices in distance order from the source until the target (if any) is settled,
+         * on_settle(parent, v, dist) is called for every settled vertex
+         */
+        template<std::invocable<vertex_t, vertex_t, dist_t> SettleCallback = NoSettleCallback>
+        void search(const IGraph<vertex_t, edge_props_t> &graph, vertex_t source,
+                    std::optional<vertex_t> target = std::nullopt, SettleCallback &&on_settle = {}) {
+            nextGeneration();
+            queue_.clear();
+            queue_.push(0, {source, source});
+            CTPL_STAT_INC(queue_pushes);
+
+            dist_t dist = 0;
+            auto relax = [&](vertex_t u, vertex_t v, edge_props_t props) {
+                CTPL_STAT_INC(edge_relaxations);
+                if (isReached(v)) {
+                    return;
+                }
+                CTPL_STAT_INC(queue_pushes);
+                queue_.push(dist + edgeLength(props), {u, v});
+            };
+            while (!queue_.empty()) {
+                auto [d, entry] = queue_.pop();
+                CTPL_STAT_INC(queue_pops);
+                if (isReached(entry.v)) {
+                    CTPL_STAT_INC(stale_pops);
+                    continue;
+                }
+                CTPL_STAT_INC(settled_vertices);
+                settle(entry.parent, entry.v, d);
+                on_settle(entry.parent, entry.v, d);
+                if (entry.v == target) {
+                    return;
+                }
+                dist = d;
+                // std::function keeps a reference_wrapper inline, a capturing lambda could be heap allocated
+                graph.visitAdjacentVertices(entry.v, std::ref(relax));
+            }
+        }
+
+        /**
+         * @brief Same visiting order as bfsCustom (dfsCustom for depth_first), vertices are marked on discovery.
+         * distance() is the depth in the traversal tree afterwards
+         */
+        template<bool depth_first, std::invocable<vertex_t> Visitor>
+        void traverse(const IGraph<vertex_t, edge_props_t> &graph, vertex_t source, Visitor &&visitor) {
+            nextGeneration();
+            frontier_.clear();
+            frontier_.push_back(source);
+            CTPL_STAT_INC(queue_pushes);
+            settle(source, source, 0);
+
+            vertex_t u = source;
+            auto relax = [&](vertex_t, vertex_t v, edge_props_t) {
+                CTPL_STAT_INC(edge_relaxations);
+                if (isReached(v)) {
+                    return;
+                }
+                settle(u, v, dists_[static_cast<std::size_t>(u)] + 1);
+                frontier_.push_back(v);
+                CTPL_STAT_INC(queue_pushes);
+            };
+            // BFS reads the frontier as a queue from head, DFS pops it as a stack
+            std::size_t head = 0;
+            while (head < frontier_.size()) {
+                if constexpr (depth_first) {
+                    u = frontier_.back();
+                    frontier_.pop_back();
+                } else {
+                    u = frontier_[head++];
+                }
+                CTPL_STAT_INC(queue_pops);
+                CTPL_STAT_INC(settled_vertices);
+                visitor(u);
+                graph.visitAdjacentVertices(u, std::ref(relax));
+            }
+        }
+
+        /**
+         * @return whether the vertex was settled by the last search
+         */
+        [[nodiscard]]
+        bool isReached(vertex_t v) const noexcept {
+            auto i = static_cast<std::size_t>(v);
+            return i < stamps_.size() && stamps_[i] == generation_;
+        }
+
+        /**
+         * @return distance from the source of the last search, the vertex must be reached
+         */
+        [[nodiscard]]
+        dist_t distance(vertex_t v) const noexcept {
+            CTPL_ASSERT(isReached(v), "vertex isn't reached");
+            return dists_[static_cast<std::size_t>(v)];
+        }
+
+        /**
+         * @return previous vertex on the shortest path from the source (the source for itself),
+         * the vertex must be reached
+         */
+        [[nodiscard]]
+        vertex_t parent(vertex_t v) const noexcept {
+            CTPL_ASSERT(isReached(v), "vertex isn't reached");
+            return parents_[static_cast<std::size_t>(v)];
+        }
+
+    private:
+        void nextGeneration() noexcept {
+            if (++generation_ == 0) {
+                std::fill(stamps_.begin(), stamps_.end(), 0);
+                generation_ = 1;
+            }
+        }
+
+        void settle(vertex_t parent, vertex_t v, dist_t dist) {
+            CTPL_ASSERT(v >= 0, "vertices must be numbered from 0");
+            auto i = static_cast<std::size_t>(v);
+            if (i >= stamps_.size()) {
+                std::size_t size = std::max(i + 1, 2 * stamps_.size());
+                stamps_.resize(size, 0);
+                parents_.resize(size);
+                dists_.resize(size);
+            }
+            stamps_[i] = generation_;
+            parents_[i] = parent;
+            dists_[i] = dist;
+        }
+
+        std::vector<std::uint32_t> stamps_{};
+        std::vector<vertex_t> parents_{};
+        std::vector<dist_t> dists_{};
+        std::vector<vertex_t> frontier_{};
+        std::uint32_t generation_ = 0;
+        decltype(detail::makeWorkspaceQueue<edge_props_t, QueueEntry>()) queue_ =
+                detail::makeWorkspaceQueue<edge_props_t, QueueEntry>();
+    };
+
     template<typename vertex_t, typename edge_props_t>
     auto dijkstra(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex) {
         std::unordered_set<vertex_t> used;
@@ -138,23 +474,161 @@ namespace ctpl {
         return res;
     }
 
+    template<typename vertex_t, typename edge_props_t>
+    std::unordered_map<vertex_t, distance_t<edge_props_t>>
+    distances(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex) {
+        std::unordered_map<vertex_t, distance_t<edge_props_t>> dist;
+        std::unordered_set<vertex_t> used;
+        shortestPathsCustom(graph, initial_vertex,
+                            [&](vertex_t u) { return used.contains(u); },
+                            [&](vertex_t, vertex_t v) { used.insert(v); },
+                            [&](vertex_t v, distance_t<edge_props_t> d) { dist[v] = d; });
+        return dist;
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    std::optional<distance_t<edge_props_t>>
+    shortestPathLength(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex) {
+        std::unordered_set<vertex_t> used;
+        std::optional<distance_t<edge_props_t>> res;
+        shortestPathsCustom(graph, initial_vertex,
+                            [&](vertex_t u) { return used.contains(u); },
+                            [&](vertex_t, vertex_t v) { used.insert(v); },
+                            [&](vertex_t v, distance_t<edge_props_t> d) {
+                                if (v == target_vertex) {
+                                    res = d;
+                                }
+                            });
+        return res;
+    }
+
     template<typename vertex_t, typename edge_props_t>
     std::vector<vertex_t>
     shortestPath(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex) {
         std::unordered_map<vertex_t, vertex_t> parents;
-        dijkstraCustom(graph, initial_vertex, [&](vertex_t u) { return parents.contains(u); },
-                       [&](vertex_t u, vertex_t v) { parents[v] = u; }, [](vertex_t, vertex_t) {});
+        shortestPathsCustom(graph, initial_vertex, [&](vertex_t u) { return parents.contains(u); },
+                            [&](vertex_t u, vertex_t v) { parents[v] = u; },
+                            [](vertex_t, distance_t<edge_props_t>) {});
         std::vector<vertex_t> path = {target_vertex};
         if (!parents.contains(target_vertex)) {
             return {};
         }
 
-        std::reverse(path.begin(), path.end());
-
         while (path.back() != initial_vertex) {
             path.push_back(parents[path.back()]);
         }
 
+        std::reverse(path.begin(), path.end());
+
+        return path;
+    }
+
+    /*
+     * Entry points reusing a SearchWorkspace, results of the search stay in the workspace until the next query
+     */
+
+    template<typename vertex_t, typename edge_props_t, std::invocable<vertex_t> Visitor>
+    void dfsCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, Visitor &&visitor,
+                   SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        workspace.template traverse<true>(graph, initial_vertex, visitor);
+    }
+
+    template<typename vertex_t, typename edge_props_t, std::invocable<vertex_t> Visitor>
+    void bfsCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, Visitor &&visitor,
+                   SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        workspace.template traverse<false>(graph, initial_vertex, visitor);
+    }
+
+    /**
+     * @brief The workspace keeps the visited set, the callbacks are called in settling order.
+     * The workspace queue for MaxWeight<1> is a two bucket Dial queue, so this is 0-1 BFS as well
+     */
+    template<
+            typename vertex_t,
+            typename edge_props_t,
+            std::invocable<vertex_t, vertex_t> SetVisitedCallback,
+            std::invocable<vertex_t, distance_t<edge_props_t>> SetDistCallback
+    >
+    void shortestPathsCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex,
+                             SetVisitedCallback &&set_visited, SetDistCallback &&set_dist,
+                             SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        workspace.search(graph, initial_vertex, std::nullopt,
+                         [&](vertex_t u, vertex_t v, distance_t<edge_props_t> dist) {
+                             set_visited(u, v);
+                             set_dist(v, dist);
+                         });
+    }
+
+    template<
+            typename vertex_t,
+            typename edge_props_t,
+            std::invocable<vertex_t, vertex_t> SetVisitedCallback,
+            std::invocable<vertex_t, distance_t<edge_props_t>> SetDistCallback
+    >
+    void zeroOneBfsCustom(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex,
+                          SetVisitedCallback &&set_visited, SetDistCallback &&set_dist,
+                          SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        static_assert(!IsPropsWeighted<edge_props_t>::value ||
+                      (std::is_integral_v<distance_t<edge_props_t>> && detail::declaredMaxWeight<edge_props_t>() <= 1),
+                      "0-1 BFS is applicable only to integer MaxWeight<1>");
+        shortestPathsCustom(graph, initial_vertex, set_visited, set_dist, workspace);
+    }
+
+    /**
+     * @return the workspace with distances to all reachable vertices
+     */
+    template<typename vertex_t, typename edge_props_t>
+    const SearchWorkspace<vertex_t, edge_props_t> &
+    distances(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex,
+              SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        workspace.search(graph, initial_vertex);
+        return workspace;
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    std::optional<distance_t<edge_props_t>>
+    shortestPathLength(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex,
+                       SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        workspace.search(graph, initial_vertex, target_vertex);
+        if (!workspace.isReached(target_vertex)) {
+            return std::nullopt;
+        }
+        return workspace.distance(target_vertex);
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    auto dijkstra(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex,
+                  SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        static_assert(IsPropsWeighted<edge_props_t>::value, "dijkstra is applicable only to weighted graphs");
+        return shortestPathLength(graph, initial_vertex, target_vertex, workspace);
+    }
+
+    /**
+     * @brief Writes the path to out (cleared first), so a reused vector doesn't allocate either
+     * @return whether the target is reachable
+     */
+    template<typename vertex_t, typename edge_props_t>
+    bool shortestPath(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex,
+                      SearchWorkspace<vertex_t, edge_props_t> &workspace, std::vector<vertex_t> &out) {
+        out.clear();
+        workspace.search(graph, initial_vertex, target_vertex);
+        if (!workspace.isReached(target_vertex)) {
+            return false;
+        }
+        out.push_back(target_vertex);
+        while (out.back() != initial_vertex) {
+            out.push_back(workspace.parent(out.back()));
+        }
+        std::reverse(out.begin(), out.end());
+        return true;
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    std::vector<vertex_t>
+    shortestPath(const IGraph<vertex_t, edge_props_t> &graph, vertex_t initial_vertex, vertex_t target_vertex,
+                 SearchWorkspace<vertex_t, edge_props_t> &workspace) {
+        std::vector<vertex_t> path;
+        shortestPath(graph, initial_vertex, target_vertex, workspace, path);
         return path;
     }
 
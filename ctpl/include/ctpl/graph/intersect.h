@@ -0,0 +1,139 @@
+#pragma once
+
+#include <ctpl/graph/IndexedGraph.h>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ctpl {
+    /*
+     * Intersection kernels over sorted arrays of unique ids (e.g. IndexedGraph::adjacentVertices).
+     * 32-bit ids are compared block by block with SSE2 or AVX2 when the target supports it, everything else
+     * falls back to the scalar merge.
+     */
+
+    namespace detail {
+        template<typename T, typename OnMatch>
+        std::size_t intersectScalar(const T* a, std::size_t na, const T* b, std::size_t nb, OnMatch&& on_match) {
+            std::size_t i = 0;
+            std::size_t j = 0;
+            std::size_t count = 0;
+            while (i < na && j < nb) {
+                if (a[i] < b[j]) {
+                    ++i;
+                } else if (b[j] < a[i]) {
+                    ++j;
+                } else {
+                    on_match(a[i]);
+                    ++count;
+                    ++i;
+                    ++j;
+                }
+            }
+            return count;
+        }
+
+        template<typename T>
+        static constexpr bool is_simd_id = std::is_integral_v<T> && sizeof(T) == 4;
+
+#if defined(__AVX2__)
+        inline constexpr std::size_t SIMD_BLOCK = 8;
+
+        // bit i is set iff a[i] equals one of b[0..8)
+        inline unsigned matchBlock(const void* a, const void* b) {
+            __m256i va = _mm256_loadu_si256(static_cast<const __m256i*>(a));
+            __m256i vb = _mm256_loadu_si256(static_cast<const __m256i*>(b));
+            __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+            __m256i eq = _mm256_cmpeq_epi32(va, vb);
+            for (int r = 1; r < 8; r++) {
+                vb = _mm256_permutevar8x32_epi32(vb, rotate);
+                eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(va, vb));
+            }
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+        }
+#elif defined(__SSE2__)
+        inline constexpr std::size_t SIMD_BLOCK = 4;
+
+        // bit i is set iff a[i] equals one of b[0..4)
+        inline unsigned matchBlock(const void* a, const void* b) {
+            __m128i va = _mm_loadu_si128(static_cast<const __m128i*>(a));
+            __m128i vb = _mm_loadu_si128(static_cast<const __m128i*>(b));
+            __m128i eq0 = _mm_cmpeq_epi32(va, vb);
+            __m128i eq1 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)));
+            __m128i eq2 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)));
+            __m128i eq3 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)));
+            __m128i eq = _mm_or_si128(_mm_or_si128(eq0, eq1), _mm_or_si128(eq2, eq3));
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+        }
+#else
+        inline constexpr std::size_t SIMD_BLOCK = 0;
+#endif
+
+        template<typename T, typename OnMatch>
+        std::size_t intersect(const T* a, std::size_t na, const T* b, std::size_t nb, OnMatch&& on_match) {
+            std::size_t i = 0;
+            std::size_t j = 0;
+            std::size_t count = 0;
+            if constexpr (is_simd_id<T> && SIMD_BLOCK > 0) {
+                while (i + SIMD_BLOCK <= na && j + SIMD_BLOCK <= nb) {
+                    unsigned mask = matchBlock(a + i, b + j);
+                    count += std::popcount(mask);
+                    for (unsigned m = mask; m != 0; m &= m - 1) {
+                        on_match(a[i + std::countr_zero(m)]);
+                    }
+                    T a_last = a[i + SIMD_BLOCK - 1];
+                    T b_last = b[j + SIMD_BLOCK - 1];
+                    if (a_last <= b_last) {
+                        i += SIMD_BLOCK;
+                    }
+                    if (b_last <= a_last) {
+                        j += SIMD_BLOCK;
+                    }
+                }
+            }
+            return count + intersectScalar(a + i, na - i, b + j, nb - j, on_match);
+        }
+    }
+
+    /**
+     * @return size of the intersection of two sorted arrays of unique values
+     */
+    template<typename T>
+    std::size_t sortedIntersectionSize(std::span<const T> a, std::span<const T> b) {
+        return detail::intersect(a.data(), a.size(), b.data(), b.size(), [](const T&) {});
+    }
+
+    /**
+     * @brief Writes the intersection of two sorted arrays of unique values to out (in increasing order),
+     * out must have room for min(a.size(), b.size()) values
+     * @return size of the intersection
+     */
+    template<typename T>
+    std::size_t sortedIntersection(std::span<const T> a, std::span<const T> b, T* out) {
+        return detail::intersect(a.data(), a.size(), b.data(), b.size(), [&out](const T& x) {
+            *out++ = x;
+        });
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    std::size_t commonNeighboursCount(const IndexedGraph<vertex_t, edge_props_t>& graph, vertex_t u, vertex_t v) {
+        return sortedIntersectionSize(graph.adjacentVertices(u), graph.adjacentVertices(v));
+    }
+
+    template<typename vertex_t, typename edge_props_t>
+    std::vector<vertex_t> commonNeighbours(const IndexedGraph<vertex_t, edge_props_t>& graph, vertex_t u, vertex_t v) {
+        auto adj_u = graph.adjacentVertices(u);
+        auto adj_v = graph.adjacentVertices(v);
+        std::vector<vertex_t> res(std::min(adj_u.size(), adj_v.size()));
+        res.resize(sortedIntersection(adj_u, adj_v, res.data()));
+        return res;
+    }
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <ctpl/util/assert.h>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ctpl {
+    /*
+     * Priority queues usable as a dijkstraCustom policy. Every queue is a template over (key_t, value_t) with
+     *   void push(key_t key, value_t value);
+     *   std::pair<key_t, value_t> pop(); // entry with the minimal key
+     *   bool empty() const;
+     *   void clear(); // keeps allocated storage
+     */
+
+    template<typename key_t, typename value_t>
+    class BinaryHeapQueue {
+        using entry = std::pair<key_t, value_t>;
+    public:
+        void push(key_t key, value_t value) {
+            heap_.push_back({key, value});
+            std::push_heap(heap_.begin(), heap_.end(), greater);
+        }
+
+        std::pair<key_t, value_t> pop() {
+            CTPL_ASSERT(!empty(), "pop from empty queue");
+            std::pop_heap(heap_.begin(), heap_.end(), greater);
+            entry res = heap_.back();
+            heap_.pop_back();
+            return res;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return heap_.empty();
+        }
+
+        void clear() noexcept {
+            heap_.clear();
+        }
+
+    private:
+        static bool greater(const entry& lhs, const entry& rhs) {
+            return lhs.first > rhs.first;
+        }
+
+        std::vector<entry> heap_{};
+    };
+
+    /**
+     * @brief Dial's circular bucket queue for monotone integer keys, O(1) push and O(max key delta) pop
+     * amortized over the whole run. Every pushed key must be in [last popped key, last popped key + bucket count),
+     * otherwise the bucket array grows
+     */
+    template<typename key_t, typename value_t>
+    class DialQueue {
+        static_assert(std::is_integral_v<key_t>, "Dial's queue is applicable only to integer keys");
+    public:
+        DialQueue() = default;
+
+        explicit DialQueue(std::size_t max_key_delta) : buckets_(max_key_delta + 1) {
+        }
+
+        void push(key_t key, value_t value) {
+            CTPL_ASSERT(key >= current_, "keys must be monotone");
+            auto delta = static_cast<std::size_t>(key - current_);
+            if (delta >= buckets_.size()) {
+                grow(delta + 1);
+            }
+            buckets_[static_cast<std::size_t>(key) % buckets_.size()].push_back(value);
+            ++size_;
+        }
+
+        std::pair<key_t, value_t> pop() {
+            CTPL_ASSERT(!empty(), "pop from empty queue");
+            while (buckets_[static_cast<std::size_t>(current_) % buckets_.size()].empty()) {
+                ++current_;
+            }
+            auto& bucket = buckets_[static_cast<std::size_t>(current_) % buckets_.size()];
+            value_t value = bucket.back();
+            bucket.pop_back();
+            --size_;
+            return {current_, value};
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        void clear() noexcept {
+            for (auto& bucket : buckets_) {
+                bucket.clear();
+            }
+            size_ = 0;
+            current_ = 0;
+        }
+
+    private:
+        void grow(std::size_t min_size) {
+            std::vector<std::vector<value_t>> buckets(std::max(min_size, 2 * buckets_.size()));
+            std::size_t n = buckets_.size();
+            for (std::size_t i = 0; i < n; i++) {
+                // keys of pending entries are in [current_, current_ + n), so the bucket index identifies the key
+                std::size_t offset = (i + n - static_cast<std::size_t>(current_) % n) % n;
+                auto key = static_cast<std::size_t>(current_) + offset;
+                auto& target = buckets[key % buckets.size()];
+                target.insert(target.end(), buckets_[i].begin(), buckets_[i].end());
+            }
+            buckets_ = std::move(buckets);
+        }
+
+        std::vector<std::vector<value_t>> buckets_ = std::vector<std::vector<value_t>>(1);
+        std::size_t size_ = 0;
+        key_t current_ = 0;
+    };
+
+    /**
+     * @brief Radix heap for monotone non-negative integer keys, O(log C) amortized per operation
+     * where C is the maximal key
+     */
+    template<typename key_t, typename value_t>
+    class RadixHeapQueue {
+        static_assert(std::is_integral_v<key_t>, "radix heap is applicable only to integer keys");
+        using ukey_t = std::make_unsigned_t<key_t>;
+        using entry = std::pair<ukey_t, value_t>;
+        static constexpr std::size_t BUCKET_COUNT = std::numeric_limits<ukey_t>::digits + 1;
+    public:
+        void push(key_t key, value_t value) {
+            CTPL_ASSERT(key >= 0 && static_cast<ukey_t>(key) >= last_, "keys must be monotone and non-negative");
+            buckets_[bucketIndex(static_cast<ukey_t>(key))].push_back({static_cast<ukey_t>(key), value});
+            ++size_;
+        }
+
+        std::pair<key_t, value_t> pop() {
+            CTPL_ASSERT(!empty(), "pop from empty queue");
+            if (buckets_[0].empty()) {
+                std::size_t i = 1;
+                while (buckets_[i].empty()) {
+                    ++i;
+                }
+                last_ = std::min_element(buckets_[i].begin(), buckets_[i].end(), [](const entry& lhs, const entry& rhs) {
+                    return lhs.first < rhs.first;
+                })->first;
+                for (const entry& e : buckets_[i]) {
+                    buckets_[bucketIndex(e.first)].push_back(e);
+                }
+                buckets_[i].clear();
+            }
+            entry res = buckets_[0].back();
+            buckets_[0].pop_back();
+            --size_;
+            return {static_cast<key_t>(res.first), res.second};
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        void clear() noexcept {
+            for (auto& bucket : buckets_) {
+                bucket.clear();
+            }
+            size_ = 0;
+            last_ = 0;
+        }
+
+    private:
+        std::size_t bucketIndex(ukey_t key) const noexcept {
+            return static_cast<std::size_t>(std::bit_width(static_cast<ukey_t>(key ^ last_)));
+        }
+
+        std::vector<entry> buckets_[BUCKET_COUNT];
+        std::size_t size_ = 0;
+        ukey_t last_ = 0;
+    };
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace ctpl {
+    /**
+     * @brief Lazy sequence produced by a coroutine (co_yield), the coroutine runs only while the consumer
+     * asks for the next value, so it can be suspended between any two values for arbitrary time.
+     * Exceptions thrown by the coroutine are rethrown from next()
+     */
+    template<typename T>
+    class Generator {
+    public:
+        struct promise_type {
+            std::optional<T> current{};
+            std::exception_ptr error{};
+
+            Generator get_return_object() {
+                return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_always yield_value(T value) {
+                current = std::move(value);
+                return {};
+            }
+
+            void return_void() noexcept {
+            }
+
+            void unhandled_exception() noexcept {
+                error = std::current_exception();
+            }
+        };
+
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            explicit iterator(Generator* generator) : generator_(generator) {
+            }
+
+            const T& operator*() const {
+                return generator_->value();
+            }
+
+            const T* operator->() const {
+                return &generator_->value();
+            }
+
+            iterator& operator++() {
+                if (!generator_->next()) {
+                    generator_ = nullptr;
+                }
+                return *this;
+            }
+
+            void operator++(int) {
+                ++*this;
+            }
+
+            bool operator==(std::default_sentinel_t) const noexcept {
+                return generator_ == nullptr;
+            }
+
+        private:
+            Generator* generator_ = nullptr;
+        };
+
+        Generator(Generator&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {
+        }
+
+        Generator& operator=(Generator&& other) noexcept {
+            if (this != &other) {
+                destroy();
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+
+        Generator(const Generator&) = delete;
+        Generator& operator=(const Generator&) = delete;
+
+        ~Generator() {
+            destroy();
+        }
+
+        /**
+         * @brief Resumes the coroutine until the next value or its end
+         * @return false if the sequence is over
+         */
+        bool next() {
+            if (!handle_ || handle_.done()) {
+                return false;
+            }
+            handle_.resume();
+            if (handle_.promise().error) {
+                std::rethrow_exception(std::exchange(handle_.promise().error, nullptr));
+            }
+            return !handle_.done();
+        }
+
+        /**
+         * @return the last produced value, valid after next() returned true
+         */
+        [[nodiscard]]
+        const T& value() const {
+            return *handle_.promise().current;
+        }
+
+        [[nodiscard]]
+        bool done() const noexcept {
+            return !handle_ || handle_.done();
+        }
+
+        iterator begin() {
+            return next() ? iterator(this) : iterator();
+        }
+
+        std::default_sentinel_t end() const noexcept {
+            return {};
+        }
+
+    private:
+        explicit Generator(std::coroutine_handle<promise_type> handle) : handle_(handle) {
+        }
+
+        void destroy() noexcept {
+            if (handle_) {
+                handle_.destroy();
+                handle_ = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+}
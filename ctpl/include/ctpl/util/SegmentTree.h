@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ctpl/util/assert.h>
+#include <utility>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Bottom-up segment tree over [0, n): point assignment and range folding in O(log n).
+     * Combine must be associative, identity must be its neutral element
+     */
+    template<typename T, typename Combine>
+    class SegmentTree {
+    public:
+        SegmentTree(std::size_t size, T identity, Combine combine = Combine())
+                : size_(size), identity_(identity), combine_(std::move(combine)), tree_(2 * size, identity) {
+        }
+
+        void set(std::size_t i, T value) {
+            CTPL_ASSERT(i < size_, "index is out of range");
+            i += size_;
+            tree_[i] = std::move(value);
+            for (i /= 2; i > 0; i /= 2) {
+                tree_[i] = combine_(tree_[2 * i], tree_[2 * i + 1]);
+            }
+        }
+
+        [[nodiscard]]
+        const T& get(std::size_t i) const {
+            return tree_[i + size_];
+        }
+
+        /**
+         * @return fold of the values in [l, r), identity for an empty range
+         */
+        [[nodiscard]]
+        T query(std::size_t l, std::size_t r) const {
+            T left = identity_;
+            T right = identity_;
+            for (l += size_, r += size_; l < r; l /= 2, r /= 2) {
+                if (l & 1) {
+                    left = combine_(left, tree_[l++]);
+                }
+                if (r & 1) {
+                    right = combine_(tree_[--r], right);
+                }
+            }
+            return combine_(left, right);
+        }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept {
+            return size_;
+        }
+
+    private:
+        std::size_t size_;
+        T identity_;
+        Combine combine_;
+        std::vector<T> tree_;
+    };
+}
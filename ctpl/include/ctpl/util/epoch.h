@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Epoch based reclamation domain (SRCU style) for read-mostly structures: readers wrap accesses
+     * into a Guard, which costs one uncontended atomic increment on a per-thread slot, writers retire
+     * unpublished objects and they are deleted once every reader that could have seen them has left.
+     * retire/synchronize must be serialized by the caller (e.g. by a writer mutex)
+     */
+    class EpochDomain {
+        static constexpr std::size_t SLOT_COUNT = 64;
+        static constexpr std::size_t RECLAIM_THRESHOLD = 64;
+
+        struct alignas(64) Slot {
+            std::array<std::atomic<std::int64_t>, 2> readers{};
+        };
+
+        struct Retired {
+            const void* object;
+            void (*deleter)(const void*);
+        };
+    public:
+        class Guard {
+        public:
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+
+            ~Guard() {
+                slot_.readers[parity_].fetch_sub(1, std::memory_order_release);
+            }
+
+        private:
+            friend class EpochDomain;
+
+            explicit Guard(const EpochDomain& domain) : slot_(domain.slots_[threadSlot()]) {
+                parity_ = domain.epoch_.load(std::memory_order_acquire) & 1;
+                slot_.readers[parity_].fetch_add(1, std::memory_order_relaxed);
+                // pairs with the fence in synchronize: either the writer sees this reader or the reader sees
+                // everything published before the epoch flip
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            Slot& slot_;
+            std::size_t parity_;
+        };
+
+        EpochDomain() = default;
+
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+        ~EpochDomain() {
+            reclaim();
+        }
+
+        [[nodiscard]]
+        Guard enter() const {
+            return Guard(*this);
+        }
+
+        /**
+         * @brief Schedules deletion of an object that is no longer reachable for new readers
+         */
+        template<typename T>
+        void retire(const T* object) {
+            retired_.push_back({object, [](const void* p) {
+                delete static_cast<const T*>(p);
+            }});
+            if (retired_.size() >= RECLAIM_THRESHOLD) {
+                synchronize();
+                reclaim();
+            }
+        }
+
+        /**
+         * @brief Waits until every reader that entered before the call has left
+         */
+        void synchronize() {
+            // two flips: a reader may read the parity right before a flip and register after the wait
+            for (int i = 0; i < 2; i++) {
+                std::size_t old_parity = epoch_.fetch_add(1, std::memory_order_acq_rel) & 1;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                for (const Slot& slot : slots_) {
+                    while (slot.readers[old_parity].load(std::memory_order_acquire) != 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Waits for readers and deletes everything retired so far
+         */
+        void barrier() {
+            synchronize();
+            reclaim();
+        }
+
+    private:
+        static std::size_t threadSlot() noexcept {
+            static thread_local std::size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id()) % SLOT_COUNT;
+            return slot;
+        }
+
+        // callers must synchronize first
+        void reclaim() {
+            for (const auto& [object, deleter] : retired_) {
+                deleter(object);
+            }
+            retired_.clear();
+        }
+
+        mutable std::array<Slot, SLOT_COUNT> slots_{};
+        std::atomic<std::uint64_t> epoch_ = 0;
+        std::vector<Retired> retired_{};
+    };
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Approximate heap footprint of a structure split into named components, e.g. "adjacency entries".
+     * Container sizes are estimated from their capacity and node layout, allocator overhead isn't counted
+     */
+    struct MemoryUsage {
+        std::vector<std::pair<std::string_view, std::size_t>> components{};
+
+        MemoryUsage& add(std::string_view component, std::size_t bytes) {
+            for (auto& [name, size] : components) {
+                if (name == component) {
+                    size += bytes;
+                    return *this;
+                }
+            }
+            components.emplace_back(component, bytes);
+            return *this;
+        }
+
+        MemoryUsage& add(const MemoryUsage& other) {
+            for (const auto& [name, size] : other.components) {
+                add(name, size);
+            }
+            return *this;
+        }
+
+        [[nodiscard]]
+        std::size_t total() const noexcept {
+            std::size_t res = 0;
+            for (const auto& [name, size] : components) {
+                res += size;
+            }
+            return res;
+        }
+    };
+
+    template<typename T>
+    std::size_t vectorMemory(const std::vector<T>& v) noexcept {
+        return v.capacity() * sizeof(T);
+    }
+
+    /**
+     * @return bucket array size of a node based unordered container
+     */
+    template<typename HashContainer>
+    std::size_t hashBucketsMemory(const HashContainer& c) noexcept {
+        return c.bucket_count() * sizeof(void*);
+    }
+
+    /**
+     * @return size of the nodes of a node based unordered container (value and the next pointer)
+     */
+    template<typename HashContainer>
+    std::size_t hashNodesMemory(const HashContainer& c) noexcept {
+        return c.size() * (sizeof(typename HashContainer::value_type) + sizeof(void*));
+    }
+}
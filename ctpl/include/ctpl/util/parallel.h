@@ -0,0 +1,51 @@
+#pragma once
+
+#include <ctpl/util/stats.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ctpl {
+    /**
+     * @brief Calls f(i) for every i in [0, count) on up to threads threads (the caller's thread included),
+     * the first exception thrown by f is rethrown to the caller, remaining indices are skipped.
+     * Stats counters of the other threads are added to the caller's ones
+     */
+    template<typename F>
+    void parallelFor(std::size_t count, std::size_t threads, F&& f) {
+        std::atomic<std::size_t> next = 0;
+        std::atomic<bool> failed = false;
+        std::exception_ptr error;
+
+        auto worker = [&]() {
+            for (std::size_t i = next++; i < count && !failed; i = next++) {
+                try {
+                    f(i);
+                } catch (...) {
+                    if (!failed.exchange(true)) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        StatsCollector collector;
+        std::vector<std::thread> pool;
+        for (std::size_t i = 1; i < std::min(std::max<std::size_t>(threads, 1), count); i++) {
+            pool.emplace_back([&]() {
+                worker();
+                collector.collect();
+            });
+        }
+        worker();
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        collector.mergeIntoCaller();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+/*
+ * Operation counters for hot paths of graph algorithms and storages. They are compiled in only with
+ * CTPL_ENABLE_STATS=1 (cmake -DCTPL_ENABLE_STATS=ON), otherwise CTPL_STAT_* expand to nothing and
+ * their arguments aren't evaluated.
+ * Counters are per thread, so parallel searches don't contend on them. parallelFor and AdversarySolver
+ * add the counters of their worker threads to the thread that joins them.
+ */
+
+#ifndef CTPL_ENABLE_STATS
+#define CTPL_ENABLE_STATS 0
+#endif
+
+namespace ctpl {
+    struct Stats {
+        // pushes into search queues (heaps, buckets, deques, dfs stack)
+        std::uint64_t queue_pushes = 0;
+        std::uint64_t queue_pops = 0;
+        // pops of already settled vertices (lazy deletion in Dijkstra and 0-1 BFS)
+        std::uint64_t stale_pops = 0;
+        // adjacent edges scanned by searches
+        std::uint64_t edge_relaxations = 0;
+        std::uint64_t settled_vertices = 0;
+        // isEdgeBelongs / getEdgeProps lookups in graph storages
+        std::uint64_t edge_probes = 0;
+        // extra entries in hash buckets met by edge probes
+        std::uint64_t hash_collisions = 0;
+
+        Stats& operator+=(const Stats& other) noexcept {
+            queue_pushes += other.queue_pushes;
+            queue_pops += other.queue_pops;
+            stale_pops += other.stale_pops;
+            edge_relaxations += other.edge_relaxations;
+            settled_vertices += other.settled_vertices;
+            edge_probes += other.edge_probes;
+            hash_collisions += other.hash_collisions;
+            return *this;
+        }
+    };
+
+    inline constexpr bool STATS_ENABLED = CTPL_ENABLE_STATS;
+
+    /**
+     * @return counters of the calling thread
+     */
+    inline Stats& stats() noexcept {
+        static thread_local Stats stats;
+        return stats;
+    }
+
+    inline void resetStats() noexcept {
+        stats() = {};
+    }
+
+    /**
+     * @brief Sums counters of worker threads: each worker calls collect() when it's done,
+     * the thread that joins them calls mergeIntoCaller() after the join
+     */
+    class StatsCollector {
+    public:
+        void collect() {
+            if constexpr (STATS_ENABLED) {
+                std::lock_guard lock(mutex_);
+                total_ += stats();
+            }
+        }
+
+        void mergeIntoCaller() noexcept {
+            stats() += total_;
+        }
+
+    private:
+        std::mutex mutex_{};
+        Stats total_{};
+    };
+}
+
+#if CTPL_ENABLE_STATS
+#define CTPL_STAT_ADD(counter, value) (::ctpl::stats().counter += (value))
+#else
+#define CTPL_STAT_ADD(counter, value) ((void) 0)
+#endif
+
+#define CTPL_STAT_INC(counter) CTPL_STAT_ADD(counter, 1)
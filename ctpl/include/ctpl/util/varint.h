@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ctpl {
+    /*
+     * LEB128 varints for compact binary formats: 7 bits per byte, the high bit marks continuation.
+     * Signed values are zigzag mapped first, so small negative values stay short
+     */
+
+    inline void putVarint(std::string& out, std::uint64_t x) {
+        for (; x >= 0x80; x >>= 7) {
+            out.push_back(static_cast<char>(x | 0x80));
+        }
+        out.push_back(static_cast<char>(x));
+    }
+
+    /**
+     * @brief Reads a varint at pos and advances pos past it
+     * @return std::nullopt if the data is truncated or the varint is longer than 64 bits
+     */
+    inline std::optional<std::uint64_t> getVarint(std::string_view data, std::size_t& pos) {
+        std::uint64_t res = 0;
+        for (unsigned shift = 0; shift < 64 && pos < data.size(); shift += 7) {
+            auto byte = static_cast<std::uint8_t>(data[pos++]);
+            res |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return res;
+            }
+        }
+        return std::nullopt;
+    }
+
+    constexpr std::uint64_t zigzagEncode(std::int64_t x) noexcept {
+        return (static_cast<std::uint64_t>(x) << 1) ^ (x < 0 ? ~std::uint64_t{0} : 0);
+    }
+
+    constexpr std::int64_t zigzagDecode(std::uint64_t x) noexcept {
+        return static_cast<std::int64_t>((x >> 1) ^ (~(x & 1) + 1));
+    }
+}
@@ -1,5 +1,6 @@
 #include <ctpl/game/outerplanar/DividedBuilder.h>
 #include <ctpl/util/assert.h>
+#include <algorithm>
 
 namespace ctpl::game {
     template<typename Iterator>
@@ -25,4 +26,43 @@ namespace ctpl::game {
         std::copy(v.begin(), v.end(), std::back_inserter(side_b_));
         return *this;
     }
+
+    Permutation<default_vertex_t> outerFaceOrder(const DividedOuterplanarBuilder &builder) {
+        std::size_t vertex_count = builder.deducedVertexCount();
+        for (const auto *side : {&builder.sideA(), &builder.sideB()}) {
+            for (default_vertex_t u : *side) {
+                vertex_count = std::max<std::size_t>(vertex_count, u + std::size_t{1});
+            }
+        }
+
+        std::vector<bool> placed(vertex_count, false);
+        std::vector<default_vertex_t> order;
+        order.reserve(vertex_count);
+        auto place = [&](default_vertex_t u) {
+            if (!placed[u]) {
+                placed[u] = true;
+                order.push_back(u);
+            }
+        };
+        std::for_each(builder.sideA().begin(), builder.sideA().end(), place);
+        std::for_each(builder.sideB().rbegin(), builder.sideB().rend(), place);
+        for (default_vertex_t u = 0; u < vertex_count; u++) {
+            place(u);
+        }
+        return Permutation<default_vertex_t>(std::move(order));
+    }
+
+    DividedOuterplanarBuilder reordered(const DividedOuterplanarBuilder &builder,
+                                        const Permutation<default_vertex_t> &permutation) {
+        DividedOuterplanarBuilder res;
+        res.withVertexCount(permutation.size());
+        res.reserveEdges(builder.edges().size());
+        for (const auto &e : builder.edges()) {
+            res.withEdge(permutation.toNew(e.u), permutation.toNew(e.v), e);
+        }
+        res.withSideAVec(permutation.toNew(builder.sideA()));
+        res.withSideBVec(permutation.toNew(builder.sideB()));
+        res.withTrusted(builder.isTrusted());
+        return res;
+    }
 }
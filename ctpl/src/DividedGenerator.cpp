@@ -0,0 +1,98 @@
+#include <ctpl/game/outerplanar/DividedGenerator.h>
+#include <ctpl/util/assert.h>
+#include <ctpl/util/parallel.h>
+#include <algorithm>
+#include <random>
+
+namespace ctpl::game {
+    namespace {
+        // uniform value in [0, range) without division (Lemire's multiply-shift)
+        std::uint64_t boundedRandom(std::mt19937_64& rng, std::uint64_t range) {
+            return static_cast<std::uint64_t>((static_cast<unsigned __int128>(rng()) * range) >> 64);
+        }
+
+        std::uint64_t splitmix64(std::uint64_t x) {
+            x += 0x9e3779b97f4a7c15ULL;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+    }
+
+    DividedOuterplanarBuilder generateDividedOuterplanar(const DividedOuterplanarGeneratorOptions& options) {
+        CTPL_ASSERT(options.vertex_count >= 3, "divided outerplanar graph needs at least 3 vertices");
+        CTPL_ASSERT(options.min_weight <= options.max_weight, "weight range is empty");
+
+        std::mt19937_64 rng(options.seed);
+        auto n = static_cast<default_vertex_t>(options.vertex_count);
+        auto weight_range = static_cast<std::uint64_t>(options.max_weight - options.min_weight) + 1;
+        auto chord_threshold = static_cast<std::uint64_t>(
+                std::clamp(options.chord_density, 0.0, 1.0) * static_cast<double>(std::uint64_t{1} << 53));
+        auto random_props = [&]() {
+            outerplanar_props_t props;
+            props.weight = options.min_weight + static_cast<weight_t>(boundedRandom(rng, weight_range));
+            return props;
+        };
+
+        // p interior vertices on side A, q on side B
+        auto p = static_cast<default_vertex_t>(boundedRandom(rng, n - 1));
+        default_vertex_t q = n - 2 - p;
+        default_vertex_t source = 0;
+        default_vertex_t target = p + 1;
+
+        std::vector<default_vertex_t> side_a(p + 2);
+        std::vector<default_vertex_t> side_b(q + 2);
+        for (default_vertex_t i = 0; i <= p + 1; i++) {
+            side_a[i] = i;
+        }
+        side_b.front() = source;
+        for (default_vertex_t j = 1; j <= q; j++) {
+            side_b[j] = p + 1 + j;
+        }
+        side_b.back() = target;
+
+        DividedOuterplanarBuilder builder;
+        builder.withVertexCount(n);
+        builder.reserveEdges(n + static_cast<std::size_t>(std::max(options.chord_density, 0.0) * n) + 2);
+        for (std::size_t i = 0; i + 1 < side_a.size(); i++) {
+            builder.withEdge(side_a[i], side_a[i + 1], random_props());
+        }
+        for (std::size_t j = 0; j + 1 < side_b.size(); j++) {
+            builder.withEdge(side_b[j], side_b[j + 1], random_props());
+        }
+
+        // chords (side_a[i], side_b[j]) are pairwise non-crossing iff both coordinates are monotone,
+        // so they are sampled along a random monotone lattice walk from (1, 1) to (p, q)
+        if (p > 0 && q > 0) {
+            default_vertex_t i = 1;
+            default_vertex_t j = 1;
+            while (true) {
+                if ((rng() >> 11) < chord_threshold) {
+                    builder.withEdge(side_a[i], side_b[j], random_props());
+                }
+                if (i == p && j == q) {
+                    break;
+                }
+                // steps are chosen proportionally to the remaining distance, so the walk follows the diagonal
+                bool step_a = j == q || (i < p && boundedRandom(rng, (p - i) + (q - j)) < p - i);
+                (step_a ? i : j)++;
+            }
+        }
+
+        builder.withSideAVec(side_a);
+        builder.withSideBVec(side_b);
+        builder.withTrusted();
+        return builder;
+    }
+
+    std::vector<DividedOuterplanarBuilder> generateDividedOuterplanarMany(
+            const DividedOuterplanarGeneratorOptions& options, std::size_t count, std::size_t threads) {
+        std::vector<DividedOuterplanarBuilder> res(count);
+        parallelFor(count, threads, [&](std::size_t i) {
+            DividedOuterplanarGeneratorOptions instance_options = options;
+            instance_options.seed = splitmix64(options.seed ^ splitmix64(i));
+            res[i] = generateDividedOuterplanar(instance_options);
+        });
+        return res;
+    }
+}
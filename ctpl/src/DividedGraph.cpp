@@ -1,7 +1,10 @@
 #include <ctpl/game/outerplanar/DividedGraph.h>
+#include <ctpl/graph/IndexedGraph.h>
+#include <ctpl/graph/intersect.h>
 #include <ctpl/util/assert.h>
 #include <exception>
 #include <format>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace ctpl::game {
@@ -11,9 +14,215 @@ namespace ctpl::game {
                     reason)) {
     }
 
+    DividedOuterplanarGraph::InvalidEdgeException::InvalidEdgeException(const std::string &reason) :
+            std::runtime_error(std::format("edge can't be added to divided outerplanar graph: {}", reason)) {
+    }
+
     DividedOuterplanarGraph::DividedOuterplanarGraph(const DividedOuterplanarBuilder &builder) : super(builder),
                                                                                                  side_a_(builder.sideA()),
                                                                                                  side_b_(builder.sideB()) {
+        if (!builder.isTrusted()) {
+            validate(builder);
+        }
+        buildPositionIndex();
+    }
+
+    void DividedOuterplanarGraph::addEdge(vertex u, vertex v, outerplanar_props_t props) {
+        if (!cycle_position_.contains(u) || !cycle_position_.contains(v)) {
+            throw InvalidEdgeException(std::format("({}, {}) has an endpoint that isn't part of the sides", u, v));
+        }
+        if (!tryAddEdge(u, v, props)) {
+            throw InvalidEdgeException(std::format("({}, {}) crosses an existing chord", u, v));
+        }
+    }
+
+    bool DividedOuterplanarGraph::tryAddEdge(vertex u, vertex v, outerplanar_props_t props) {
+        if (!canAddEdge(u, v)) {
+            return false;
+        }
+        super::addEdge(u, v, props);
+        std::size_t pos_u = cycle_position_.at(u);
+        std::size_t pos_v = cycle_position_.at(v);
+        auto extend = [&](std::size_t pos, std::size_t partner) {
+            PartnerRange range = partner_ranges_.get(pos);
+            partner_ranges_.set(pos, {std::min(range.min, partner), std::max(range.max, partner)});
+        };
+        extend(pos_u, pos_v);
+        extend(pos_v, pos_u);
+        updateChordIndex(u, v, true);
+        return true;
+    }
+
+    bool DividedOuterplanarGraph::canAddEdge(vertex u, vertex v) const {
+        auto it_u = cycle_position_.find(u);
+        auto it_v = cycle_position_.find(v);
+        if (it_u == cycle_position_.end() || it_v == cycle_position_.end()) {
+            return false;
+        }
+        auto [a, b] = std::minmax(it_u->second, it_v->second);
+        if (b - a <= 1) {
+            return true;
+        }
+        // (a, b) crosses a chord iff some vertex strictly between them has a neighbour strictly outside [a, b]
+        PartnerRange inner = partner_ranges_.query(a + 1, b);
+        return inner.min >= a && inner.max <= b;
+    }
+
+    void DividedOuterplanarGraph::removeEdge(vertex u, vertex v) {
+        super::removeEdge(u, v);
+        refreshPartnerRange(u);
+        refreshPartnerRange(v);
+        updateChordIndex(u, v, false);
+    }
+
+    void DividedOuterplanarGraph::applyMutations(std::span<const Mutation<vertex, outerplanar_props_t>> mutations) {
+        using mutation_t = Mutation<vertex, outerplanar_props_t>;
+        std::vector<std::pair<std::size_t, std::size_t>> added;
+        for (const auto &m : mutations) {
+            if (m.type != mutation_t::Type::ADD) {
+                continue;
+            }
+            if (!cycle_position_.contains(m.u) || !cycle_position_.contains(m.v)) {
+                throw InvalidEdgeException(
+                        std::format("({}, {}) has an endpoint that isn't part of the sides", m.u, m.v));
+            }
+            auto [a, b] = std::minmax(cycle_position_.at(m.u), cycle_position_.at(m.v));
+            bool crosses_added = std::any_of(added.begin(), added.end(), [&](const auto &edge) {
+                auto [c, d] = edge;
+                return (a < c && c < b && b < d) || (c < a && a < d && d < b);
+            });
+            if (crosses_added || !canAddEdge(m.u, m.v)) {
+                throw InvalidEdgeException(std::format("({}, {}) crosses an existing chord", m.u, m.v));
+            }
+            added.emplace_back(a, b);
+        }
+
+        std::vector<vertex> touched;
+        touched.reserve(2 * mutations.size());
+        for (const auto &m : mutations) {
+            if (m.type == mutation_t::Type::ADD) {
+                super::addEdge(m.u, m.v, m.props);
+            } else {
+                super::removeEdge(m.u, m.v);
+            }
+            touched.push_back(m.u);
+            touched.push_back(m.v);
+        }
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+        for (vertex u : touched) {
+            refreshPartnerRange(u);
+        }
+        for (const auto &m : mutations) {
+            updateChordIndex(m.u, m.v, isEdgeBelongs(m.u, m.v));
+        }
+    }
+
+    std::optional<SidePosition> DividedOuterplanarGraph::sidePosition(vertex u) const {
+        auto it = cycle_position_.find(u);
+        if (it == cycle_position_.end()) {
+            return std::nullopt;
+        }
+        std::size_t pos = it->second;
+        if (pos < side_a_.size()) {
+            return SidePosition{Side::A, pos};
+        }
+        return SidePosition{Side::B, side_a_.size() - 1 + side_b_.size() - 1 - pos};
+    }
+
+    bool DividedOuterplanarGraph::isChord(vertex u, vertex v) const {
+        auto pos_u = sidePosition(u);
+        auto pos_v = sidePosition(v);
+        if (!pos_u || !pos_v || pos_u->side == pos_v->side) {
+            return false;
+        }
+        // the source and the target are reported on side A, so the B endpoint is always interior
+        auto a_index = pos_u->side == Side::A ? pos_u->index : pos_v->index;
+        return a_index != 0 && a_index + 1 != side_a_.size() && isEdgeBelongs(u, v);
+    }
+
+    std::vector<Chord> DividedOuterplanarGraph::chords() const {
+        return chordsInRange(Side::A, 0, side_a_.size());
+    }
+
+    std::optional<Chord> DividedOuterplanarGraph::nextChord(Side side, std::size_t index) const {
+        const auto &chords = chordsBy(side);
+        auto it = chords.lower_bound({index + 1, 0});
+        if (it == chords.end()) {
+            return std::nullopt;
+        }
+        return chordAt(side, *it);
+    }
+
+    std::vector<Chord> DividedOuterplanarGraph::chordsInRange(Side side, std::size_t from, std::size_t to) const {
+        const auto &chords = chordsBy(side);
+        std::vector<Chord> res;
+        for (auto it = chords.lower_bound({from, 0}); it != chords.end() && it->first < to; ++it) {
+            res.push_back(chordAt(side, *it));
+        }
+        return res;
+    }
+
+    void DividedOuterplanarGraph::updateChordIndex(vertex u, vertex v, bool present) {
+        if (present ? !isChord(u, v) : !sidePosition(u) || !sidePosition(v)) {
+            return;
+        }
+        auto pos_u = *sidePosition(u);
+        auto pos_v = *sidePosition(v);
+        if (pos_u.side == pos_v.side) {
+            return;
+        }
+        std::size_t a_index = pos_u.side == Side::A ? pos_u.index : pos_v.index;
+        std::size_t b_index = pos_u.side == Side::A ? pos_v.index : pos_u.index;
+        if (present) {
+            chords_by_a_.insert({a_index, b_index});
+            chords_by_b_.insert({b_index, a_index});
+        } else {
+            chords_by_a_.erase({a_index, b_index});
+            chords_by_b_.erase({b_index, a_index});
+        }
+    }
+
+    Chord DividedOuterplanarGraph::chordAt(Side side, const chord_key_t &key) const {
+        auto [a_index, b_index] = side == Side::A ? key : chord_key_t{key.second, key.first};
+        return {side_a_[a_index], side_b_[b_index], a_index, b_index};
+    }
+
+    void DividedOuterplanarGraph::buildPositionIndex() {
+        std::size_t vertex_count = side_a_.size() + side_b_.size() - 2;
+        cycle_position_.reserve(vertex_count);
+        for (std::size_t i = 0; i < side_a_.size(); i++) {
+            cycle_position_[side_a_[i]] = i;
+        }
+        for (std::size_t j = 1; j + 1 < side_b_.size(); j++) {
+            cycle_position_[side_b_[j]] = side_a_.size() - 1 + (side_b_.size() - 1 - j);
+        }
+        partner_ranges_ = SegmentTree<PartnerRange, PartnerRangeCombine>(vertex_count, {});
+        for (const auto &[u, pos] : cycle_position_) {
+            refreshPartnerRange(u);
+        }
+        chords_by_a_.clear();
+        chords_by_b_.clear();
+        visitAllEdges([&](vertex u, vertex v, outerplanar_props_t) {
+            updateChordIndex(u, v, true);
+        });
+    }
+
+    void DividedOuterplanarGraph::refreshPartnerRange(vertex u) {
+        auto it = cycle_position_.find(u);
+        if (it == cycle_position_.end()) {
+            return;
+        }
+        PartnerRange range;
+        visitAdjacentVertices(u, [&](vertex, vertex v, outerplanar_props_t) {
+            std::size_t pos = cycle_position_.at(v);
+            range.min = std::min(range.min, pos);
+            range.max = std::max(range.max, pos);
+        });
+        partner_ranges_.set(it->second, range);
+    }
+
+    void DividedOuterplanarGraph::validate(const DividedOuterplanarBuilder &builder) const {
         auto &side_a = builder.sideA();
         auto &side_b = builder.sideB();
 
@@ -69,47 +278,48 @@ namespace ctpl::game {
                 return index < side_a.size() ? side_a[index] : side_b[index - side_a.size() + 1];
             };
             std::size_t vertex_count = side_a.size() + side_b.size() - 2;
+
+            // structure checks run on sorted adjacency arrays of local (side order) indices
+            std::unordered_map<vertex, vertex> local_index;
             for (std::size_t i = 0; i < vertex_count; i++) {
-                auto u = vertex_by_index(i);
-                super::visitAdjacentVertices(u, [&](auto&&, vertex v, auto&&) {
+                local_index[vertex_by_index(i)] = static_cast<vertex>(i);
+            }
+            GraphBuilder<vertex, EdgeProps<Undirected>> local_builder;
+            local_builder.withVertexCount(vertex_count);
+            for (const auto& e : builder.edges()) {
+                local_builder.withEdge(local_index.at(e.u), local_index.at(e.v), {});
+            }
+            IndexedGraph<vertex, EdgeProps<Undirected>> local = local_builder;
+
+            std::vector<vertex> common;
+            for (vertex u = 0; u < vertex_count; u++) {
+                for (vertex v : local.adjacentVertices(u)) {
                     if (u >= v) {
-                        return;
+                        continue;
                     }
-                    super::visitAdjacentVertices(v, [&](auto&&, vertex w, auto&&) {
-                        if (v >= w) {
-                            return;
-                        }
-                        if (!super::isEdgeBelongs(w, u)) {
-                            return;
-                        }
-
-                        super::visitAdjacentVertices(w, [&](auto&&, vertex x, auto&&) {
-                            if (w >= x) {
-                                return;
-                            }
-                            if (!super::isEdgeBelongs(x, u) || !super::isEdgeBelongs(x, v) || !super::isEdgeBelongs(x, w)) {
-                                return;
-                            }
-
+                    common.resize(local.adjacentVertices(u).size());
+                    common.resize(sortedIntersection(local.adjacentVertices(u), local.adjacentVertices(v), common.data()));
+                    for (vertex w : common) {
+                        // u, v, w and any common neighbour x of them form K4
+                        if (sortedIntersectionSize(local.adjacentVertices(w), std::span<const vertex>(common)) > 0) {
                             throw BuildException("graph is not outerplanar");
-                        });
-                    });
-                });
+                        }
+                    }
+                }
             }
 
-            for (std::size_t i = 0; i < vertex_count; i++) {
-                auto u = vertex_by_index(i);
-                for (std::size_t j = 0; j < i; j++) {
-                    auto v = vertex_by_index(j);
-                    std::unordered_set<vertex> s;
-                    super::visitAdjacentVertices(u, [&](auto&&, vertex v, auto&&) {
-                        s.insert(v);
-                    });
-                    super::visitAdjacentVertices(v, [&](auto&&, vertex v, auto&&) {
-                        s.erase(v);
-                    });
-                    if (s.size() >= 3) {
-                        throw BuildException("graph is not outerplanar");
+            // only vertices at distance 2 may have common neighbours
+            std::vector<std::size_t> seen(vertex_count, vertex_count);
+            for (vertex u = 0; u < vertex_count; u++) {
+                for (vertex w : local.adjacentVertices(u)) {
+                    for (vertex v : local.adjacentVertices(w)) {
+                        if (v >= u || seen[v] == u) {
+                            continue;
+                        }
+                        seen[v] = u;
+                        if (commonNeighboursCount(local, u, v) >= 3) {
+                            throw BuildException("graph is not outerplanar");
+                        }
                     }
                 }
             }
@@ -0,0 +1,34 @@
+#include <ctpl/game/RatioEvaluator.h>
+#include <cmath>
+#include <format>
+
+namespace ctpl::game {
+    RatioSummary RatioSummary::of(std::span<const double> ratios) {
+        RatioSummary res;
+        res.rounds = ratios.size();
+        double sum = 0;
+        double log_sum = 0;
+        std::size_t defined = 0;
+        for (double ratio : ratios) {
+            if (std::isnan(ratio)) {
+                ++res.undefined;
+                continue;
+            }
+            res.min = defined == 0 ? ratio : std::min(res.min, ratio);
+            res.max = defined == 0 ? ratio : std::max(res.max, ratio);
+            sum += ratio;
+            log_sum += std::log(ratio);
+            ++defined;
+        }
+        if (defined > 0) {
+            res.mean = sum / static_cast<double>(defined);
+            res.geometric_mean = std::exp(log_sum / static_cast<double>(defined));
+        }
+        return res;
+    }
+
+    std::string RatioSummary::toString() const {
+        return std::format("rounds={} undefined={} mean={:.4f} gmean={:.4f} min={:.4f} max={:.4f}",
+                           rounds, undefined, mean, geometric_mean, min, max);
+    }
+}
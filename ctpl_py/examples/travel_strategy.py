@@ -22,8 +22,8 @@ class MyTraveller(ctpl.ITraveller):
         self._dist = 0
         self._path = self._round.graph.shortestPath(src_v, tar_v)
         self._budget = 1
-        self._side_a = graph.sideA()
-        self._side_b = graph.sideB()
+        # parts of the sides before these indices are cut off by the chords already crossed
+        self._side_from = {ctpl.SIDE.A: 0, ctpl.SIDE.B: 0}
         self._side = None
         self._rolling_back = False
         self._path_index = 0
@@ -32,16 +32,16 @@ class MyTraveller(ctpl.ITraveller):
         self._cur_src = v
         self._path = self.graph.shortestPath(v, self._cur_tar)
         self._side = None
-        a_index = self._side_a.index(v)
-        b_index = self._side_b.index(z)
-        if (v in self._side_a):
-            a_index = a_index + 1
-        else:
-            b_index = b_index + 1
-        self._side_a = self._side_a[a_index:]
-        self._side_b = self._side_b[b_index:]
+        (v_side, v_index) = self._graph.sidePosition(v)
+        (z_side, z_index) = self._graph.sidePosition(z)
+        self._side_from[v_side] = v_index + 1
+        self._side_from[z_side] = z_index
         self._budget = 1
 
+    def isAhead(self, position):
+        (side, index) = position
+        return index >= self._side_from[side]
+
     def isTC(self, u, v):
         if not self._graph.isEdgeBelongs(u, v):
             return False
@@ -49,7 +49,22 @@ class MyTraveller(ctpl.ITraveller):
             return False
         if (v == self._cur_tar or v == self._cur_src):
             return False
-        return ((u in self._side_a) != (v in self._side_a))
+        pos_u = self._graph.sidePosition(u)
+        pos_v = self._graph.sidePosition(v)
+        return pos_u[0] != pos_v[0] and self.isAhead(pos_u) and self.isAhead(pos_v)
+
+    def crossingChords(self, u):
+        """Chords (a, b, a_index, b_index) at u that are not cut off yet"""
+        pos = self._graph.sidePosition(u)
+        if pos is None or pos[1] == 0:
+            return []
+        (side, index) = pos
+        # cheap check first: the next chord at or after u's index on its side
+        chord = self._graph.nextChord(side, index - 1)
+        if chord is None or chord[2 if side == ctpl.SIDE.A else 3] != index:
+            return []
+        return [c for c in self._graph.chordsInRange(side, index, index + 1)
+                if self.isAhead((ctpl.SIDE.A, c[2])) and self.isAhead((ctpl.SIDE.B, c[3]))]
 
     def makeStep(self, u):
         if u == self._cur_tar:
@@ -71,18 +86,15 @@ class MyTraveller(ctpl.ITraveller):
 
         best_tc = None
         best_dist = None
-        
-        def visitor(u, v, props):
-            if not self.isTC(u, v):
-                return
-
-            if v in self._side_a:
-                cur_dist = graph.shortestPath(v, self._cur_tar)
-                if best_tc == None or best_dist > cur_dist:
-                    best_tc = v
-                    best_dist = cur_dist
 
-        self._graph.visitAdjVertices(u, visitor)
+        # only chords from side B to side A are taken
+        for (a, b, a_index, b_index) in self.crossingChords(u):
+            if a == u:
+                continue
+            cur_dist = self._graph.shortestPathLength(a, self._cur_tar)
+            if best_tc is None or best_dist > cur_dist:
+                best_tc = a
+                best_dist = cur_dist
 
         if best_tc is not None:
             self.resourcing(u, best_tc)
@@ -1,12 +1,26 @@
 #include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/IndexedGraph.h>
+#include <ctpl/graph/IndexedGraphView.h>
+#include <ctpl/graph/MatrixGraph.h>
+#include <ctpl/graph/KShortestPaths.h>
+#include <ctpl/graph/MinCut.h>
+#include <ctpl/game/RatioEvaluator.h>
 #include <ctpl/game/Round.h>
 #include <ctpl/game/outerplanar/DividedGraph.h>
 #include <ctpl/util/assert.h>
+#include <ctpl/util/stats.h>
+#include <ctpl/util/varint.h>
 #include <ctpl/graph/algo.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
+#include <algorithm>
+#include <cstring>
 #include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
 
 using namespace pybind11::literals;
 
@@ -14,6 +28,22 @@ namespace ctpl::py {
     using vertex_t = game::default_vertex_t;
     using weight_t = game::weight_t;
 
+    enum class GraphBackend {
+        // hash map adjacency, supports mutations
+        DYNAMIC = 0,
+        // immutable CSR layout with sorted adjacency, mutations are rejected
+        INDEXED = 1,
+        // bit matrix over vertices [0, n), supports mutations (except for divided graphs), memory is O(n^2)
+        MATRIX = 2
+    };
+
+    class FrozenGraphException : public std::runtime_error {
+        using super = std::runtime_error;
+    public:
+        FrozenGraphException() : super("graph is frozen, mutations are not supported") {
+        }
+    };
+
     namespace detail {
         struct EdgeProps {
             std::optional<weight_t> weight = std::nullopt;
@@ -36,6 +66,225 @@ namespace ctpl::py {
         };
 
         using EdgeVisitor = std::function<void(vertex_t, vertex_t, EdgeProps)>;
+        using Sides = std::pair<std::vector<vertex_t>, std::vector<vertex_t>>;
+
+        /**
+         * @brief Pickle state of graphs and builders: magic, version byte, flags byte, backend byte, then varints:
+         * edge count, edges as u, v and zigzag weight for weighted graphs, side lengths and vertices for divided ones
+         */
+        struct GraphPayload {
+            static constexpr std::string_view MAGIC = "CTPG";
+            static constexpr std::uint8_t VERSION = 1;
+            static constexpr std::uint8_t DIRECTED = 1;
+            static constexpr std::uint8_t WEIGHTED = 2;
+            static constexpr std::uint8_t DIVIDED = 4;
+
+            bool directed = false;
+            bool weighted = false;
+            GraphBackend backend = GraphBackend::DYNAMIC;
+            std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges{};
+            std::optional<Sides> sides{};
+
+            [[nodiscard]]
+            std::string encode() const {
+                std::string res(MAGIC);
+                res.push_back(static_cast<char>(VERSION));
+                res.push_back(static_cast<char>((directed ? DIRECTED : 0) | (weighted ? WEIGHTED : 0) |
+                                                (sides ? DIVIDED : 0)));
+                res.push_back(static_cast<char>(backend));
+                putVarint(res, edges.size());
+                for (const auto &[u, v, w] : edges) {
+                    putVarint(res, u);
+                    putVarint(res, v);
+                    if (weighted) {
+                        putVarint(res, zigzagEncode(w));
+                    }
+                }
+                if (sides) {
+                    for (const auto *side : {&sides->first, &sides->second}) {
+                        putVarint(res, side->size());
+                        for (vertex_t u : *side) {
+                            putVarint(res, u);
+                        }
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * @throws std::invalid_argument (ValueError) if data isn't a payload encoded by encode()
+             */
+            static GraphPayload decode(std::string_view data) {
+                std::size_t pos = MAGIC.size() + 3;
+                if (!data.starts_with(MAGIC) || data.size() < pos ||
+                    static_cast<std::uint8_t>(data[MAGIC.size()]) != VERSION ||
+                    static_cast<std::uint8_t>(data[MAGIC.size() + 2]) > static_cast<std::uint8_t>(GraphBackend::MATRIX)) {
+                    throw std::invalid_argument("not a ctpl graph payload or unsupported version");
+                }
+                auto flags = static_cast<std::uint8_t>(data[MAGIC.size() + 1]);
+                GraphPayload payload{
+                        .directed = (flags & DIRECTED) != 0,
+                        .weighted = (flags & WEIGHTED) != 0,
+                        .backend = static_cast<GraphBackend>(data[MAGIC.size() + 2])
+                };
+                auto next = [&]() {
+                    if (auto x = getVarint(data, pos)) {
+                        return *x;
+                    }
+                    throw std::invalid_argument("graph payload is truncated");
+                };
+                // every element takes at least a byte, so the counts can't exceed the payload size
+                auto count = [&]() {
+                    std::uint64_t n = next();
+                    if (n > data.size() - pos) {
+                        throw std::invalid_argument("graph payload is truncated");
+                    }
+                    return n;
+                };
+
+                payload.edges.resize(count());
+                for (auto &[u, v, w] : payload.edges) {
+                    u = static_cast<vertex_t>(next());
+                    v = static_cast<vertex_t>(next());
+                    w = payload.weighted ? static_cast<weight_t>(zigzagDecode(next())) : 1;
+                }
+                if (flags & DIVIDED) {
+                    payload.sides.emplace();
+                    for (auto *side : {&payload.sides->first, &payload.sides->second}) {
+                        side->resize(count());
+                        for (vertex_t &u : *side) {
+                            u = static_cast<vertex_t>(next());
+                        }
+                    }
+                }
+                if (pos != data.size()) {
+                    throw std::invalid_argument("trailing bytes in graph payload");
+                }
+                return payload;
+            }
+        };
+
+        /**
+         * @brief Header of a frozen graph in a shared buffer, followed by CSR offsets, targets, packed weights
+         * (weighted graphs only) and the sides (divided graphs only), each array is 8 byte aligned
+         */
+        struct SharedHeader {
+            static constexpr std::uint64_t MAGIC = 0x31475053'4c505443;  // "CTPLSPG1"
+
+            std::uint64_t magic = MAGIC;
+            std::uint64_t flags = 0;
+            std::uint64_t vertex_size = sizeof(vertex_t);
+            std::uint64_t offset_size = sizeof(std::size_t);
+            std::uint64_t vertex_count = 0;
+            std::uint64_t entry_count = 0;
+            std::uint64_t side_a = 0;
+            std::uint64_t side_b = 0;
+
+            struct Layout {
+                std::size_t offsets;
+                std::size_t targets;
+                std::size_t props;
+                std::size_t side_a;
+                std::size_t side_b;
+                std::size_t size;
+            };
+
+            [[nodiscard]]
+            Layout layout() const noexcept {
+                auto align = [](std::size_t x) {
+                    return (x + 7) / 8 * 8;
+                };
+                Layout res{};
+                res.offsets = sizeof(SharedHeader);
+                res.targets = res.offsets + (vertex_count + 1) * sizeof(std::size_t);
+                res.props = align(res.targets + entry_count * sizeof(vertex_t));
+                res.side_a = align(res.props + ((flags & GraphPayload::WEIGHTED) ? entry_count * sizeof(weight_t) : 0));
+                res.side_b = align(res.side_a + side_a * sizeof(vertex_t));
+                res.size = align(res.side_b + side_b * sizeof(vertex_t));
+                return res;
+            }
+        };
+
+        /**
+         * @brief Side and chord queries of divided graphs stored outside DividedOuterplanarGraph, answers are
+         * the same as of its indices. Such graphs are immutable, so the index is built once over sorted vectors
+         */
+        class DividedIndex {
+            // (index on the queried side, index on the other side)
+            using chord_key_t = std::pair<std::size_t, std::size_t>;
+        public:
+            template<typename edge_props_t>
+            DividedIndex(const Sides &sides, const ::ctpl::IGraph<vertex_t, edge_props_t> &graph) {
+                const auto &[side_a, side_b] = sides;
+                for (std::size_t i = 0; i < side_a.size(); i++) {
+                    positions_[side_a[i]] = {game::Side::A, i};
+                }
+                for (std::size_t j = 1; j + 1 < side_b.size(); j++) {
+                    positions_[side_b[j]] = {game::Side::B, j};
+                }
+                graph.visitAllEdges([&](vertex_t u, vertex_t v, edge_props_t) {
+                    auto pos_u = sidePosition(u);
+                    auto pos_v = sidePosition(v);
+                    if (!pos_u || !pos_v || pos_u->side == pos_v->side) {
+                        return;
+                    }
+                    std::size_t a_index = pos_u->side == game::Side::A ? pos_u->index : pos_v->index;
+                    std::size_t b_index = pos_u->side == game::Side::A ? pos_v->index : pos_u->index;
+                    if (a_index != 0 && a_index + 1 != side_a.size()) {
+                        chords_by_a_.emplace_back(a_index, b_index);
+                        chords_by_b_.emplace_back(b_index, a_index);
+                    }
+                });
+                for (auto *chords : {&chords_by_a_, &chords_by_b_}) {
+                    std::sort(chords->begin(), chords->end());
+                    chords->erase(std::unique(chords->begin(), chords->end()), chords->end());
+                }
+            }
+
+            [[nodiscard]]
+            std::optional<game::SidePosition> sidePosition(vertex_t u) const {
+                if (auto it = positions_.find(u); it != positions_.end()) {
+                    return it->second;
+                }
+                return std::nullopt;
+            }
+
+            [[nodiscard]]
+            std::optional<game::Chord> nextChord(const Sides &sides, game::Side side, std::size_t index) const {
+                const auto &chords = chordsBy(side);
+                auto it = std::lower_bound(chords.begin(), chords.end(), chord_key_t{index + 1, 0});
+                if (it == chords.end()) {
+                    return std::nullopt;
+                }
+                return chordAt(sides, side, *it);
+            }
+
+            [[nodiscard]]
+            std::vector<game::Chord> chordsInRange(const Sides &sides, game::Side side, std::size_t from,
+                                                   std::size_t to) const {
+                const auto &chords = chordsBy(side);
+                std::vector<game::Chord> res;
+                for (auto it = std::lower_bound(chords.begin(), chords.end(), chord_key_t{from, 0});
+                     it != chords.end() && it->first < to; ++it) {
+                    res.push_back(chordAt(sides, side, *it));
+                }
+                return res;
+            }
+
+        private:
+            const std::vector<chord_key_t> &chordsBy(game::Side side) const noexcept {
+                return side == game::Side::A ? chords_by_a_ : chords_by_b_;
+            }
+
+            static game::Chord chordAt(const Sides &sides, game::Side side, const chord_key_t &key) {
+                auto [a_index, b_index] = side == game::Side::A ? key : chord_key_t{key.second, key.first};
+                return {sides.first[a_index], sides.second[b_index], a_index, b_index};
+            }
+
+            std::unordered_map<vertex_t, game::SidePosition> positions_{};
+            std::vector<chord_key_t> chords_by_a_{};
+            std::vector<chord_key_t> chords_by_b_{};
+        };
 
         class IGraph {
         public:
@@ -59,10 +308,61 @@ namespace ctpl::py {
                 throw std::runtime_error("side B getter is not implemented");
             }
 
+            virtual std::optional<game::SidePosition> sidePosition(vertex_t) {
+                throw std::runtime_error("side position index is not implemented");
+            }
+
+            virtual std::optional<game::Chord> nextChord(game::Side, std::size_t) {
+                throw std::runtime_error("chord index is not implemented");
+            }
+
+            virtual std::vector<game::Chord> chordsInRange(game::Side, std::size_t, std::size_t) {
+                throw std::runtime_error("chord index is not implemented");
+            }
+
             virtual std::vector<vertex_t> shortestPath(vertex_t s, vertex_t t) = 0;
 
             virtual std::optional<weight_t> shortestPathLength(vertex_t s, vertex_t t) = 0;
 
+            virtual std::vector<std::pair<std::vector<vertex_t>, weight_t>>
+            kShortestPaths(vertex_t s, vertex_t t, std::size_t k) = 0;
+
+            virtual std::pair<std::size_t, std::vector<std::pair<vertex_t, vertex_t>>> minCut(vertex_t s, vertex_t t) = 0;
+
+            virtual game::RoundEvaluation<weight_t> evaluateRound(const game::RoundRecord<vertex_t> &round) = 0;
+
+            virtual GraphBackend backend() = 0;
+
+            /**
+             * @return whether addEdge / removeEdge throw FrozenGraphException
+             */
+            virtual bool isFrozen() = 0;
+
+            virtual MemoryUsage memoryUsage() = 0;
+
+            virtual void compact() = 0;
+
+            /**
+             * @return immutable copy of the graph in the INDEXED backend
+             */
+            virtual std::unique_ptr<IGraph> freeze() = 0;
+
+            virtual GraphPayload payload() = 0;
+
+            /**
+             * @return size of the buffer for writeShared()
+             */
+            virtual std::size_t sharedSize() {
+                return freeze()->sharedSize();
+            }
+
+            /**
+             * @brief Writes a frozen copy of the graph to the buffer, see SharedHeader for the layout
+             */
+            virtual void writeShared(std::span<std::byte> out) {
+                freeze()->writeShared(out);
+            }
+
             virtual ~IGraph() = default;
         };
 
@@ -70,9 +370,26 @@ namespace ctpl::py {
         class Graph : public IGraph {
             using vertex_t = graph_impl_t::vertex;
             using edge_props_t = graph_impl_t::edge_props;
+            static constexpr bool IS_DIVIDED = std::is_same_v<graph_impl_t, ::ctpl::game::DividedOuterplanarGraph>;
+            static constexpr bool IS_MUTABLE = std::is_base_of_v<IDynamicGraph<vertex_t, edge_props_t>, graph_impl_t>;
+            static constexpr bool IS_INDEXED = std::is_same_v<graph_impl_t, IndexedGraph<vertex_t, edge_props_t>>;
+            static constexpr bool IS_WEIGHTED = has_prop<Weighted<weight_t>, edge_props_t>;
         public:
             template<typename builder_t>
             explicit Graph(const builder_t &builder) : graph_(builder) {
+                if constexpr (std::is_same_v<builder_t, ::ctpl::game::DividedOuterplanarBuilder>) {
+                    sides_ = {builder.sideA(), builder.sideB()};
+                }
+                buildDividedIndex();
+            }
+
+            /**
+             * @brief Divided graphs on other backends than DividedOuterplanarGraph are immutable,
+             * mutations would bypass its outerplanarity checks
+             */
+            template<typename builder_t>
+            Graph(const builder_t &builder, std::optional<Sides> sides) : graph_(builder), sides_(std::move(sides)) {
+                buildDividedIndex();
             }
 
             void visitAdjacentVertices(vertex_t u, const EdgeVisitor &visitor) override {
@@ -100,17 +417,27 @@ namespace ctpl::py {
             }
 
             void addEdge(vertex_t u, vertex_t v, EdgeProps e) override {
-                if constexpr (has_prop<Weighted<weight_t>, edge_props_t>) {
-                    edge_props_t p;
-                    p.weight = e.weight.value_or(1);
-                    graph_.addEdge(u, v, p);
-                } else {
-                    graph_.addEdge(u, v, {});
+                if constexpr (IS_MUTABLE) {
+                    if (!isFrozen()) {
+                        edge_props_t p{};
+                        if constexpr (has_prop<Weighted<weight_t>, edge_props_t>) {
+                            p.weight = e.weight.value_or(1);
+                        }
+                        graph_.addEdge(u, v, p);
+                        return;
+                    }
                 }
+                throw FrozenGraphException();
             }
 
             void removeEdge(vertex_t u, vertex_t v) override {
-                graph_.removeEdge(u, v);
+                if constexpr (IS_MUTABLE) {
+                    if (!isFrozen()) {
+                        graph_.removeEdge(u, v);
+                        return;
+                    }
+                }
+                throw FrozenGraphException();
             }
 
             std::optional<EdgeProps> getEdgeProps(vertex_t u, vertex_t v) override {
@@ -130,53 +457,203 @@ namespace ctpl::py {
             }
 
             const std::vector<vertex_t> &sideA() override {
-                if constexpr (std::is_same_v<graph_impl_t, ::ctpl::game::DividedOuterplanarGraph>) {
-                    return graph_.sideA();
-                } else {
+                if (!sides_) {
                     IGraph::sideA();
                 }
-                CTPL_UNREACHABLE();
+                return sides_->first;
             }
 
             const std::vector<vertex_t> &sideB() override {
-                if constexpr (std::is_same_v<graph_impl_t, ::ctpl::game::DividedOuterplanarGraph>) {
-                    return graph_.sideB();
-                } else {
+                if (!sides_) {
                     IGraph::sideB();
                 }
-                CTPL_UNREACHABLE();
+                return sides_->second;
             }
 
-            std::vector<vertex_t> shortestPath(vertex_t s, vertex_t t) override {
-                if constexpr (IsPropsWeighted<edge_props_t>::value) {
-                    return ::ctpl::shortestPath(graph_, s, t);
+            std::optional<game::SidePosition> sidePosition(vertex_t u) override {
+                if constexpr (IS_DIVIDED) {
+                    return graph_.sidePosition(u);
+                } else if (divided_index_) {
+                    return divided_index_->sidePosition(u);
+                } else {
+                    return IGraph::sidePosition(u);
                 }
-                else {
-                    return {};
+            }
+
+            std::optional<game::Chord> nextChord(game::Side side, std::size_t index) override {
+                if constexpr (IS_DIVIDED) {
+                    return graph_.nextChord(side, index);
+                } else if (divided_index_) {
+                    return divided_index_->nextChord(*sides_, side, index);
+                } else {
+                    return IGraph::nextChord(side, index);
                 }
             }
 
+            std::vector<game::Chord> chordsInRange(game::Side side, std::size_t from, std::size_t to) override {
+                if constexpr (IS_DIVIDED) {
+                    return graph_.chordsInRange(side, from, to);
+                } else if (divided_index_) {
+                    return divided_index_->chordsInRange(*sides_, side, from, to);
+                } else {
+                    return IGraph::chordsInRange(side, from, to);
+                }
+            }
+
+            std::vector<vertex_t> shortestPath(vertex_t s, vertex_t t) override {
+                return ::ctpl::shortestPath(graph_, s, t);
+            }
+
             std::optional<weight_t> shortestPathLength(vertex_t s, vertex_t t) override {
-                if constexpr (IsPropsWeighted<edge_props_t>::value) {
-                    if (auto w = ::ctpl::dijkstra(graph_, s, t)) {
-                        return *w;
+                if (auto w = ::ctpl::shortestPathLength(graph_, s, t)) {
+                    return static_cast<weight_t>(*w);
+                }
+                return std::nullopt;
+            }
+
+            std::vector<std::pair<std::vector<vertex_t>, weight_t>>
+            kShortestPaths(vertex_t s, vertex_t t, std::size_t k) override {
+                std::vector<std::pair<std::vector<vertex_t>, weight_t>> res;
+                for (auto &path : ::ctpl::kShortestPaths(graph_, s, t, k)) {
+                    res.emplace_back(std::move(path.vertices), static_cast<weight_t>(path.length));
+                }
+                return res;
+            }
+
+            std::pair<std::size_t, std::vector<std::pair<vertex_t, vertex_t>>> minCut(vertex_t s, vertex_t t) override {
+                MinCut<vertex_t, edge_props_t> cut(graph_, s, t);
+                return {cut.value(), cut.cutEdges()};
+            }
+
+            game::RoundEvaluation<weight_t> evaluateRound(const game::RoundRecord<vertex_t> &round) override {
+                auto res = game::evaluateRound(graph_, round);
+                std::optional<weight_t> offline_optimum;
+                if (res.offline_optimum) {
+                    offline_optimum = static_cast<weight_t>(*res.offline_optimum);
+                }
+                return {static_cast<weight_t>(res.walked), offline_optimum, res.ratio};
+            }
+
+            MemoryUsage memoryUsage() override {
+                return graph_.memoryUsage();
+            }
+
+            void compact() override {
+                if constexpr (IS_MUTABLE) {
+                    graph_.compact();
+                }
+            }
+
+            bool isFrozen() override {
+                return !IS_MUTABLE || divided_index_.has_value();
+            }
+
+            GraphBackend backend() override {
+                if constexpr (IS_INDEXED || std::is_same_v<graph_impl_t, IndexedGraphView<vertex_t, edge_props_t>>) {
+                    return GraphBackend::INDEXED;
+                } else if constexpr (std::is_same_v<graph_impl_t, MatrixGraph<vertex_t, edge_props_t>>) {
+                    return GraphBackend::MATRIX;
+                } else {
+                    return GraphBackend::DYNAMIC;
+                }
+            }
+
+            std::unique_ptr<IGraph> freeze() override {
+                ::ctpl::GraphBuilder<vertex_t, edge_props_t> builder;
+                graph_.visitAllEdges([&](vertex_t u, vertex_t v, edge_props_t props) {
+                    builder.withEdge(u, v, props);
+                });
+                return std::make_unique<Graph<IndexedGraph<vertex_t, edge_props_t>>>(builder, sides_);
+            }
+
+            GraphPayload payload() override {
+                GraphPayload res{
+                        .directed = has_prop<Directed, edge_props_t>,
+                        .weighted = IS_WEIGHTED,
+                        .backend = backend(),
+                        .sides = sides_
+                };
+                graph_.visitAllEdges([&](vertex_t u, vertex_t v, edge_props_t props) {
+                    if constexpr (IS_WEIGHTED) {
+                        res.edges.emplace_back(u, v, props.weight);
+                    } else {
+                        res.edges.emplace_back(u, v, 1);
                     }
-                    return std::nullopt;
+                });
+                return res;
+            }
+
+            std::size_t sharedSize() override {
+                if constexpr (IS_INDEXED) {
+                    return sharedHeader().layout().size;
+                } else {
+                    return IGraph::sharedSize();
                 }
-                else {
-                    return std::nullopt;
+            }
+
+            void writeShared(std::span<std::byte> out) override {
+                if constexpr (IS_INDEXED) {
+                    SharedHeader header = sharedHeader();
+                    auto layout = header.layout();
+                    if (out.size() < layout.size) {
+                        throw std::invalid_argument("buffer is smaller than sharedSize()");
+                    }
+                    auto write = [&](std::size_t at, const auto &range) {
+                        std::memcpy(out.data() + at, range.data(), range.size_bytes());
+                    };
+                    std::fill(out.begin(), out.begin() + layout.size, std::byte{0});
+                    std::memcpy(out.data(), &header, sizeof(header));
+                    write(layout.offsets, graph_.offsets());
+                    write(layout.targets, graph_.targets());
+                    if constexpr (IS_WEIGHTED) {
+                        static_assert(sizeof(PackedProps<edge_props_t>) == sizeof(weight_t));
+                        write(layout.props, graph_.packedProps());
+                    }
+                    if (sides_) {
+                        write(layout.side_a, std::span(sides_->first));
+                        write(layout.side_b, std::span(sides_->second));
+                    }
+                } else {
+                    IGraph::writeShared(out);
                 }
             }
 
         private:
+            void buildDividedIndex() {
+                if constexpr (!IS_DIVIDED) {
+                    if (sides_) {
+                        divided_index_.emplace(*sides_, graph_);
+                    }
+                }
+            }
+
+            SharedHeader sharedHeader() const requires IS_INDEXED {
+                return {
+                        .flags = static_cast<std::uint64_t>((has_prop<Directed, edge_props_t> ? GraphPayload::DIRECTED : 0) |
+                                                            (IS_WEIGHTED ? GraphPayload::WEIGHTED : 0) |
+                                                            (sides_ ? GraphPayload::DIVIDED : 0)),
+                        .vertex_count = graph_.vertexCount(),
+                        .entry_count = graph_.targets().size(),
+                        .side_a = sides_ ? sides_->first.size() : 0,
+                        .side_b = sides_ ? sides_->second.size() : 0
+                };
+            }
+
             graph_impl_t graph_;
+            std::optional<Sides> sides_{};
+            std::optional<DividedIndex> divided_index_{};
         };
 
         class IBuilder {
         public:
             virtual void addEdge(vertex_t u, vertex_t v, EdgeProps w) = 0;
 
-            virtual std::unique_ptr<IGraph> build() = 0;
+            virtual std::unique_ptr<IGraph> build(GraphBackend backend) = 0;
+
+            /**
+             * @return edges and sides added so far, the backend is left default
+             */
+            virtual GraphPayload payload() const = 0;
 
             virtual void withSideA(const std::vector<vertex_t> &side) {
                 throw std::runtime_error("unimplemented");
@@ -204,12 +681,31 @@ namespace ctpl::py {
                 }
             }
 
-            std::unique_ptr<IGraph> build() override {
+            std::unique_ptr<IGraph> build(GraphBackend backend) override {
                 if constexpr (std::is_same_v<builder_impl_t, ::ctpl::game::DividedOuterplanarBuilder>) {
-                    return std::make_unique<Graph<::ctpl::game::DividedOuterplanarGraph>>(builder_);
+                    // validation is done by DividedOuterplanarGraph, other backends are built from its copy
+                    auto graph = std::make_unique<Graph<::ctpl::game::DividedOuterplanarGraph>>(builder_);
+                    switch (backend) {
+                        case GraphBackend::DYNAMIC:
+                            return graph;
+                        case GraphBackend::INDEXED:
+                            return graph->freeze();
+                        case GraphBackend::MATRIX:
+                            return std::make_unique<Graph<MatrixGraph<vertex_t, edge_props_t>>>(
+                                    builder_, std::pair(builder_.sideA(), builder_.sideB()));
+                    }
                 } else {
-                    return std::make_unique<Graph<DynamicGraph<vertex_t, edge_props_t>>>(builder_);
+                    switch (backend) {
+                        case GraphBackend::DYNAMIC:
+                            return std::make_unique<Graph<DynamicGraph<vertex_t, edge_props_t>>>(builder_);
+                        case GraphBackend::INDEXED:
+                            return std::make_unique<Graph<IndexedGraph<vertex_t, edge_props_t>>>(builder_);
+                        case GraphBackend::MATRIX:
+                            return std::make_unique<Graph<MatrixGraph<vertex_t, edge_props_t>>>(builder_);
+                    }
                 }
+                CTPL_UNREACHABLE();
+                return nullptr;
             }
 
             void withSideA(const std::vector<vertex_t> &side) override {
@@ -234,6 +730,24 @@ namespace ctpl::py {
                 CTPL_UNREACHABLE();
             }
 
+            GraphPayload payload() const override {
+                GraphPayload res{
+                        .directed = has_prop<Directed, edge_props_t>,
+                        .weighted = has_prop<Weighted<weight_t>, edge_props_t>
+                };
+                for (const auto &e : builder_.edges()) {
+                    if constexpr (has_prop<Weighted<weight_t>, edge_props_t>) {
+                        res.edges.emplace_back(e.u, e.v, e.weight);
+                    } else {
+                        res.edges.emplace_back(e.u, e.v, 1);
+                    }
+                }
+                if constexpr (std::is_same_v<builder_impl_t, ::ctpl::game::DividedOuterplanarBuilder>) {
+                    res.sides = {builder_.sideA(), builder_.sideB()};
+                }
+                return res;
+            }
+
         private:
             builder_impl_t builder_;
         };
@@ -258,6 +772,123 @@ namespace ctpl::py {
             return IBuilderCreateImpl<>(directed, weighted);
         }
 
+        /**
+         * @brief Builder with the edges and sides of the payload, divided graphs are validated again by build()
+         */
+        inline std::unique_ptr<IBuilder> builderFromPayload(const GraphPayload &payload) {
+            std::unique_ptr<IBuilder> builder;
+            if (payload.sides) {
+                builder = std::make_unique<Builder<::ctpl::game::DividedOuterplanarBuilder>>();
+                builder->withSideA(payload.sides->first);
+                builder->withSideB(payload.sides->second);
+            } else {
+                builder = IBuilderCreate(payload.directed, payload.weighted);
+            }
+            for (const auto &[u, v, w] : payload.edges) {
+                builder->addEdge(u, v, {.weight = w});
+            }
+            return builder;
+        }
+
+        template<typename... Args>
+        inline std::unique_ptr<IGraph> attachSharedImpl(const SharedHeader &header, std::span<const std::byte> data) {
+            if constexpr (sizeof...(Args) < 2) {
+                bool flag = header.flags & (sizeof...(Args) == 0 ? GraphPayload::DIRECTED : GraphPayload::WEIGHTED);
+                using yes_t = std::conditional_t<sizeof...(Args) == 0, Directed, Weighted<weight_t>>;
+                using no_t = std::conditional_t<sizeof...(Args) == 0, Undirected, Unweighted>;
+                return (flag ? attachSharedImpl<Args..., yes_t> : attachSharedImpl<Args..., no_t>)(header, data);
+            } else {
+                using edge_props_t = ::ctpl::EdgeProps<Args...>;
+                using packed_props_t = PackedProps<edge_props_t>;
+                auto layout = header.layout();
+                auto array = [&]<typename T>(std::size_t at, std::size_t count, std::type_identity<T>) {
+                    return std::span(reinterpret_cast<const T *>(data.data() + at), count);
+                };
+                auto offsets = array(layout.offsets, header.vertex_count + 1, std::type_identity<std::size_t>{});
+                auto targets = array(layout.targets, header.entry_count, std::type_identity<vertex_t>{});
+                std::span<const packed_props_t> props;
+                if constexpr (!std::is_empty_v<packed_props_t>) {
+                    props = array(layout.props, header.entry_count, std::type_identity<packed_props_t>{});
+                }
+                if (offsets.front() != 0 || offsets.back() != targets.size() ||
+                    !std::is_sorted(offsets.begin(), offsets.end())) {
+                    throw std::invalid_argument("shared graph offsets are corrupted");
+                }
+
+                std::optional<Sides> sides;
+                if (header.flags & GraphPayload::DIVIDED) {
+                    auto side_a = array(layout.side_a, header.side_a, std::type_identity<vertex_t>{});
+                    auto side_b = array(layout.side_b, header.side_b, std::type_identity<vertex_t>{});
+                    sides = {{side_a.begin(), side_a.end()}, {side_b.begin(), side_b.end()}};
+                }
+                IndexedGraphView<vertex_t, edge_props_t> view(offsets, targets, props);
+                return std::make_unique<Graph<IndexedGraphView<vertex_t, edge_props_t>>>(view, std::move(sides));
+            }
+        }
+
+        /**
+         * @brief Graph over a buffer filled by IGraph::writeShared(), arrays aren't copied, so the buffer
+         * must outlive the graph
+         * @throws std::invalid_argument (ValueError) if the buffer doesn't hold a compatible graph
+         */
+        inline std::unique_ptr<IGraph> attachShared(std::span<const std::byte> data) {
+            SharedHeader header;
+            if (data.size() < sizeof(header)) {
+                throw std::invalid_argument("buffer is too small for a shared graph");
+            }
+            std::memcpy(&header, data.data(), sizeof(header));
+            if (header.magic != SharedHeader::MAGIC || header.vertex_size != sizeof(vertex_t) ||
+                header.offset_size != sizeof(std::size_t)) {
+                throw std::invalid_argument("not a shared ctpl graph or it is written by an incompatible build");
+            }
+            // counts are checked before the layout is computed, so it can't overflow
+            if (std::max({header.vertex_count, header.entry_count, header.side_a, header.side_b}) > data.size() ||
+                header.layout().size > data.size()) {
+                throw std::invalid_argument("shared graph exceeds the buffer");
+            }
+            if (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(std::uint64_t) != 0) {
+                throw std::invalid_argument("shared graph buffer must be 8 byte aligned");
+            }
+            return attachSharedImpl<>(header, data);
+        }
+
+        inline pybind11::dict toDict(const game::RoundEvaluation<weight_t> &evaluation) {
+            return pybind11::dict("walked"_a = evaluation.walked,
+                                  "offline_optimum"_a = evaluation.offline_optimum,
+                                  "ratio"_a = evaluation.ratio);
+        }
+
+        inline pybind11::dict toDict(const Stats &stats) {
+            return pybind11::dict("queue_pushes"_a = stats.queue_pushes,
+                                  "queue_pops"_a = stats.queue_pops,
+                                  "stale_pops"_a = stats.stale_pops,
+                                  "edge_relaxations"_a = stats.edge_relaxations,
+                                  "settled_vertices"_a = stats.settled_vertices,
+                                  "edge_probes"_a = stats.edge_probes,
+                                  "hash_collisions"_a = stats.hash_collisions);
+        }
+
+        inline pybind11::dict toDict(const game::RatioSummary &summary) {
+            return pybind11::dict("rounds"_a = summary.rounds,
+                                  "undefined"_a = summary.undefined,
+                                  "mean"_a = summary.mean,
+                                  "geometric_mean"_a = summary.geometric_mean,
+                                  "min"_a = summary.min,
+                                  "max"_a = summary.max);
+        }
+
+        inline pybind11::dict toDict(const game::RoundTrace<vertex_t> &trace) {
+            std::vector<std::tuple<game::TraceRecord<vertex_t>::Type, vertex_t, vertex_t>> records;
+            for (const auto &record : trace.records) {
+                records.emplace_back(record.type, record.u, record.v);
+            }
+            return pybind11::dict("graph_id"_a = trace.graph_id,
+                                  "seed"_a = trace.seed,
+                                  "source"_a = trace.source,
+                                  "target"_a = trace.target,
+                                  "records"_a = records);
+        }
+
     }
 
     enum class GraphDir {
@@ -284,6 +915,20 @@ namespace ctpl::py {
                 detail::IBuilderCreate(dir == GraphDir::DIRECTED, w == GraphWeight::WEIGHTED)) {
         }
 
+        explicit GraphBuilder(std::unique_ptr<detail::IBuilder> impl) : impl_(std::move(impl)) {
+        }
+
+        [[nodiscard]]
+        pybind11::bytes getState() const {
+            std::string state = impl_->payload().encode();
+            return {state.data(), state.size()};
+        }
+
+        static std::shared_ptr<GraphBuilder> fromState(const pybind11::bytes &state) {
+            return std::make_shared<GraphBuilder>(
+                    detail::builderFromPayload(detail::GraphPayload::decode(static_cast<std::string>(state))));
+        }
+
         std::shared_ptr<GraphBuilder> withEdgeW(vertex_t u, vertex_t v, weight_t w) {
             impl_->addEdge(u, v, {.weight = w});
             return shared_from_this();
@@ -313,8 +958,14 @@ namespace ctpl::py {
     };
 
     class Graph {
+        using ChordTuple = std::tuple<vertex_t, vertex_t, std::size_t, std::size_t>;
     public:
-        explicit Graph(const std::shared_ptr<GraphBuilder> &builder) : impl_(builder->impl()->build()) {
+        explicit Graph(const std::shared_ptr<GraphBuilder> &builder, GraphBackend backend = GraphBackend::DYNAMIC)
+                : impl_(builder->impl()->build(backend)) {
+        }
+
+        explicit Graph(std::unique_ptr<detail::IGraph> impl, std::shared_ptr<pybind11::buffer_info> shared = nullptr)
+                : shared_(std::move(shared)), impl_(std::move(impl)) {
         }
 
         void visitAdjacentVertices(vertex_t u, const std::function<void(vertex_t, vertex_t, pybind11::dict)> &visitor) {
@@ -345,6 +996,102 @@ namespace ctpl::py {
             impl_->removeEdge(u, v);
         }
 
+        /**
+         * @return approximate heap footprint in bytes per component, "total" included
+         */
+        [[nodiscard]]
+        pybind11::dict memoryUsage() const {
+            auto usage = impl_->memoryUsage();
+            pybind11::dict res;
+            for (const auto &[name, bytes] : usage.components) {
+                res[pybind11::str(name.data(), name.size())] = bytes;
+            }
+            res["total"] = usage.total();
+            return res;
+        }
+
+        void compact() {
+            impl_->compact();
+        }
+
+        [[nodiscard]]
+        GraphBackend backend() const {
+            return impl_->backend();
+        }
+
+        /**
+         * @return whether mutations raise FrozenGraphError: INDEXED graphs and divided graphs on any backend but DYNAMIC
+         */
+        [[nodiscard]]
+        bool isFrozen() const {
+            return impl_->isFrozen();
+        }
+
+        /**
+         * @return immutable read-optimized copy of the graph, the graph itself is left untouched
+         */
+        [[nodiscard]]
+        std::shared_ptr<Graph> freeze() const {
+            std::unique_ptr<detail::IGraph> frozen;
+            {
+                pybind11::gil_scoped_release release;
+                frozen = impl_->freeze();
+            }
+            return std::make_shared<Graph>(std::move(frozen));
+        }
+
+        /**
+         * @return pickle state: edges, sides and backend in a compact binary form
+         */
+        [[nodiscard]]
+        pybind11::bytes getState() const {
+            std::string state;
+            {
+                pybind11::gil_scoped_release release;
+                state = impl_->payload().encode();
+            }
+            return {state.data(), state.size()};
+        }
+
+        static std::shared_ptr<Graph> fromState(const pybind11::bytes &state) {
+            auto payload = detail::GraphPayload::decode(static_cast<std::string>(state));
+            std::unique_ptr<detail::IGraph> impl;
+            {
+                pybind11::gil_scoped_release release;
+                impl = detail::builderFromPayload(payload)->build(payload.backend);
+            }
+            return std::make_shared<Graph>(std::move(impl));
+        }
+
+        /**
+         * @return size of a buffer (e.g. multiprocessing.shared_memory) for writeShared()
+         */
+        [[nodiscard]]
+        std::size_t sharedSize() const {
+            pybind11::gil_scoped_release release;
+            return impl_->sharedSize();
+        }
+
+        /**
+         * @brief Writes a frozen copy of the graph to a writable buffer of at least sharedSize() bytes
+         */
+        void writeShared(const pybind11::buffer &buffer) const {
+            pybind11::buffer_info info = buffer.request(true);
+            std::span out(static_cast<std::byte *>(info.ptr), static_cast<std::size_t>(info.size) * info.itemsize);
+            pybind11::gil_scoped_release release;
+            impl_->writeShared(out);
+        }
+
+        /**
+         * @return frozen graph reading the buffer filled by writeShared() in place, the buffer is held
+         * (so e.g. SharedMemory.close() fails) until the graph is destroyed
+         */
+        static std::shared_ptr<Graph> attachShared(const pybind11::buffer &buffer) {
+            auto info = std::make_shared<pybind11::buffer_info>(buffer.request());
+            std::span data(static_cast<const std::byte *>(info->ptr), static_cast<std::size_t>(info->size) * info->itemsize);
+            return std::make_shared<Graph>(detail::attachShared(data), std::move(info));
+        }
+
         [[nodiscard]]
         const std::unique_ptr<detail::IGraph> &impl() const {
             return impl_;
@@ -360,6 +1107,34 @@ namespace ctpl::py {
             return impl_->sideB();
         }
 
+        /**
+         * @return (side, index) of the vertex or None, the source and the target are reported on side A
+         */
+        std::optional<std::pair<game::Side, std::size_t>> sidePosition(vertex_t u) const {
+            if (auto pos = impl_->sidePosition(u)) {
+                return std::pair(pos->side, pos->index);
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @return first chord (a, b, a_index, b_index) after the index on the side or None
+         */
+        std::optional<ChordTuple> nextChord(game::Side side, std::size_t index) const {
+            if (auto chord = impl_->nextChord(side, index)) {
+                return toTuple(*chord);
+            }
+            return std::nullopt;
+        }
+
+        std::vector<ChordTuple> chordsInRange(game::Side side, std::size_t from, std::size_t to) const {
+            std::vector<ChordTuple> res;
+            for (const auto &chord : impl_->chordsInRange(side, from, to)) {
+                res.push_back(toTuple(chord));
+            }
+            return res;
+        }
+
         auto shortestPath(vertex_t s, vertex_t t) const {
             return impl_->shortestPath(s, t);
         }
@@ -368,10 +1143,69 @@ namespace ctpl::py {
             return impl_->shortestPathLength(s, t);
         }
 
+        /**
+         * @return at most k shortest simple paths from s to t as (path, length) in non-decreasing length order
+         */
+        auto kShortestPaths(vertex_t s, vertex_t t, std::size_t k) const {
+            pybind11::gil_scoped_release release;
+            return impl_->kShortestPaths(s, t, k);
+        }
+
+        /**
+         * @return (size, edges) of a minimum set of edges separating t from s
+         */
+        auto minCut(vertex_t s, vertex_t t) const {
+            pybind11::gil_scoped_release release;
+            return impl_->minCut(s, t);
+        }
+
+        /**
+         * @param bans edges banned during the round, the graph itself must be the one before bans
+         */
+        pybind11::dict evaluateRound(const std::vector<vertex_t> &path,
+                                     const std::vector<std::pair<vertex_t, vertex_t>> &bans) const {
+            return detail::toDict(impl_->evaluateRound({path, bans}));
+        }
+
     private:
+        static ChordTuple toTuple(const game::Chord &chord) {
+            return {chord.a, chord.b, chord.a_index, chord.b_index};
+        }
+
+        // buffer of an attached graph, must outlive impl_
+        std::shared_ptr<pybind11::buffer_info> shared_;
         std::unique_ptr<detail::IGraph> impl_;
     };
 
+    using RoundTask = std::tuple<std::shared_ptr<Graph>, std::vector<vertex_t>, std::vector<std::pair<vertex_t, vertex_t>>>;
+
+    /**
+     * @brief Evaluates rounds in parallel without holding the GIL
+     * @return per round evaluations and their summary
+     */
+    inline pybind11::dict evaluateRounds(const std::vector<RoundTask> &tasks, std::size_t threads) {
+        std::vector<game::RoundRecord<vertex_t>> rounds;
+        rounds.reserve(tasks.size());
+        for (const auto &[graph, path, bans] : tasks) {
+            rounds.push_back({path, bans});
+        }
+
+        std::vector<game::RoundEvaluation<weight_t>> evaluations(tasks.size());
+        {
+            pybind11::gil_scoped_release release;
+            ::ctpl::parallelFor(tasks.size(), threads, [&](std::size_t i) {
+                evaluations[i] = std::get<0>(tasks[i])->impl()->evaluateRound(rounds[i]);
+            });
+        }
+
+        pybind11::list res;
+        for (const auto &evaluation : evaluations) {
+            res.append(detail::toDict(evaluation));
+        }
+        return pybind11::dict("rounds"_a = res,
+                              "summary"_a = detail::toDict(game::summarize<weight_t>(evaluations)));
+    }
+
     class ITraveller : public ::ctpl::game::ITraveller<vertex_t> {
         using super = ::ctpl::game::ITraveller<vertex_t>;
     public:
@@ -419,6 +1253,11 @@ namespace ctpl::py {
             PYBIND11_OVERLOAD(void, ITraveller, notifyBanned, u, v);
         }
 
+        void notifyBannedBatch(std::span<const std::pair<vertex_t, vertex_t>> edges) override {
+            std::vector<std::pair<vertex_t, vertex_t>> batch(edges.begin(), edges.end());
+            PYBIND11_OVERLOAD(void, ITraveller, notifyBannedBatch, batch);
+        }
+
     };
 
     class PyBanValidator : public IBanValidator {
@@ -460,6 +1299,27 @@ namespace ctpl::py {
                                                                                 *step_validator) {
         }
     };
+
+    /**
+     * @brief Python iterator over Round::events, yields (type, u, v) tuples
+     */
+    class RoundEvents {
+        using Event = ::ctpl::game::RoundEvent<vertex_t>;
+    public:
+        RoundEvents(PyRound &round, std::size_t max_steps) : events_(round.events(max_steps)) {
+        }
+
+        std::tuple<Event::Type, vertex_t, vertex_t> next() {
+            if (!events_.next()) {
+                throw pybind11::stop_iteration();
+            }
+            const Event &event = events_.value();
+            return {event.type, event.u, event.v};
+        }
+
+    private:
+        Generator<Event> events_;
+    };
 }
 
 PYBIND11_MODULE(ctpl_py, m) {
@@ -478,16 +1338,40 @@ PYBIND11_MODULE(ctpl_py, m) {
     pybind11::enum_<GraphTypes>(m, "TYPES")
             .value("DIVIDED_OUTERPLANAR", GraphTypes::DIVIDED_OUTERPLANAR);
 
+    pybind11::enum_<GraphBackend>(m, "BACKEND")
+            .value("DYNAMIC", GraphBackend::DYNAMIC)
+            .value("INDEXED", GraphBackend::INDEXED)
+            .value("MATRIX", GraphBackend::MATRIX);
+
+    pybind11::enum_<::ctpl::game::Side>(m, "SIDE")
+            .value("A", ::ctpl::game::Side::A)
+            .value("B", ::ctpl::game::Side::B);
+
+    pybind11::register_exception<FrozenGraphException>(m, "FrozenGraphError", PyExc_RuntimeError);
+    pybind11::register_exception<::ctpl::game::DividedOuterplanarGraph::InvalidEdgeException>(
+            m, "InvalidEdgeError", PyExc_RuntimeError);
+
     pybind11::class_<GraphBuilder, std::shared_ptr<GraphBuilder>>(m, "GraphBuilder")
             .def(pybind11::init<GraphDir, GraphWeight>())
             .def(pybind11::init<GraphTypes>())
             .def("withEdge", &GraphBuilder::withEdge)
             .def("withEdge", &GraphBuilder::withEdgeW)
             .def("withSideA", &GraphBuilder::withSideA)
-            .def("withSideB", &GraphBuilder::withSideB);
+            .def("withSideB", &GraphBuilder::withSideB)
+            .def(pybind11::pickle(&GraphBuilder::getState, &GraphBuilder::fromState));
 
     pybind11::class_<Graph, std::shared_ptr<Graph>>(m, "Graph")
-            .def(pybind11::init<std::shared_ptr<GraphBuilder>>())
+            .def(pybind11::init<std::shared_ptr<GraphBuilder>, GraphBackend>(), "builder"_a,
+                 "backend"_a = GraphBackend::DYNAMIC)
+            .def("freeze", &Graph::freeze)
+            .def(pybind11::pickle(&Graph::getState, &Graph::fromState))
+            .def("sharedSize", &Graph::sharedSize)
+            .def("writeShared", &Graph::writeShared, "buffer"_a)
+            .def_static("attachShared", &Graph::attachShared, "buffer"_a)
+            .def("memoryUsage", &Graph::memoryUsage)
+            .def("compact", &Graph::compact)
+            .def("isFrozen", &Graph::isFrozen)
+            .def("backend", &Graph::backend)
             .def("visitAdjVertices", &Graph::visitAdjacentVertices)
             .def("visitAllEdges", &Graph::visitAllEdges)
             .def("isEdgeBelongs", &Graph::isEdgeBelongs)
@@ -495,14 +1379,33 @@ PYBIND11_MODULE(ctpl_py, m) {
             .def("removeEdge", &Graph::removeEdge)
             .def("sideA", &Graph::sideA)
             .def("sideB", &Graph::sideB)
+            .def("sidePosition", &Graph::sidePosition)
+            .def("nextChord", &Graph::nextChord)
+            .def("chordsInRange", &Graph::chordsInRange)
             .def("getEdgeProps", &Graph::getEdgeProps)
             .def("shortestPath", &Graph::shortestPath)
-            .def("shortestPathLength", &Graph::shortestPathLength);
+            .def("shortestPathLength", &Graph::shortestPathLength)
+            .def("kShortestPaths", &Graph::kShortestPaths, "s"_a, "t"_a, "k"_a)
+            .def("minCut", &Graph::minCut, "s"_a, "t"_a)
+            .def("evaluateRound", &Graph::evaluateRound, "path"_a, "bans"_a = std::vector<std::pair<vertex_t, vertex_t>>{});
+
+    m.attr("STATS_ENABLED") = ::ctpl::STATS_ENABLED;
+    // counters of the calling thread, the worker threads of evaluateRounds are included,
+    // all zeros unless built with CTPL_ENABLE_STATS
+    m.def("stats", []() {
+        return detail::toDict(::ctpl::stats());
+    });
+    m.def("resetStats", &::ctpl::resetStats);
+
+    m.def("evaluateRounds", &evaluateRounds, "tasks"_a, "threads"_a = std::thread::hardware_concurrency());
 
     pybind11::class_<ITraveller, PyTraveller, std::shared_ptr<ITraveller>>(m, "ITraveller")
             .def(pybind11::init<>())
             .def("makeStep", &ITraveller::makeStep)
-            .def("notifyBanned", &ITraveller::notifyBanned);
+            .def("notifyBanned", &ITraveller::notifyBanned)
+            .def("notifyBannedBatch", [](ITraveller &traveller, const std::vector<std::pair<vertex_t, vertex_t>> &edges) {
+                traveller.notifyBannedBatch(edges);
+            });
 
     pybind11::class_<IStepValidator, PyStepValidator, std::shared_ptr<IStepValidator>>(m, "IStepValidator")
             .def(pybind11::init<>())
@@ -511,13 +1414,59 @@ PYBIND11_MODULE(ctpl_py, m) {
     pybind11::class_<IBanValidator, PyBanValidator, std::shared_ptr<IBanValidator>>(m, "IBanValidator")
             .def(pybind11::init<std::shared_ptr<PyTraveller>>())
             .def("requestBanEdge", &IBanValidator::requestBanEdge)
-            .def("tryRemove", &IBanValidator::tryRemoveEdge);
+            .def("requestBanEdges", [](IBanValidator &validator, const std::vector<std::pair<vertex_t, vertex_t>> &edges) {
+                return validator.requestBanEdges(edges);
+            })
+            .def("tryRemove", &IBanValidator::tryRemoveEdge)
+            .def("banLog", [](const IBanValidator &validator) {
+                std::vector<std::tuple<vertex_t, vertex_t, bool>> res;
+                for (const auto &request : validator.banLog()) {
+                    res.emplace_back(request.u, request.v, request.accepted);
+                }
+                return res;
+            })
+            .def("bannedEdges", &IBanValidator::bannedEdges);
 
     pybind11::class_<IAdversary, PyAdversary, std::shared_ptr<IAdversary>>(m, "IAdversary")
             .def(pybind11::init<std::shared_ptr<IBanValidator>>())
             .def("notifyTravellerStep", &IAdversary::notifyTravellerStep);
 
+    pybind11::enum_<::ctpl::game::RoundEvent<vertex_t>::Type>(m, "EVENT")
+            .value("STEP", ::ctpl::game::RoundEvent<vertex_t>::Type::STEP)
+            .value("REJECTED_STEP", ::ctpl::game::RoundEvent<vertex_t>::Type::REJECTED_STEP)
+            .value("BAN", ::ctpl::game::RoundEvent<vertex_t>::Type::BAN)
+            .value("FINISHED", ::ctpl::game::RoundEvent<vertex_t>::Type::FINISHED)
+            .value("STEP_LIMIT", ::ctpl::game::RoundEvent<vertex_t>::Type::STEP_LIMIT);
+
+    pybind11::register_exception<::ctpl::game::RoundStepLimitException>(m, "RoundStepLimitError", PyExc_RuntimeError);
+
+    pybind11::enum_<::ctpl::game::TraceRecord<vertex_t>::Type>(m, "TRACE")
+            .value("STEP", ::ctpl::game::TraceRecord<vertex_t>::Type::STEP)
+            .value("REJECTED_STEP", ::ctpl::game::TraceRecord<vertex_t>::Type::REJECTED_STEP)
+            .value("BAN", ::ctpl::game::TraceRecord<vertex_t>::Type::BAN)
+            .value("REJECTED_BAN", ::ctpl::game::TraceRecord<vertex_t>::Type::REJECTED_BAN)
+            .value("FINISHED", ::ctpl::game::TraceRecord<vertex_t>::Type::FINISHED)
+            .value("STEP_LIMIT", ::ctpl::game::TraceRecord<vertex_t>::Type::STEP_LIMIT);
+
+    pybind11::register_exception<::ctpl::game::TraceFormatException>(m, "TraceFormatError", PyExc_ValueError);
+
+    pybind11::class_<RoundEvents>(m, "RoundEvents")
+            .def("__iter__", [](RoundEvents &events) -> RoundEvents & { return events; })
+            .def("__next__", &RoundEvents::next);
+
     pybind11::class_<PyRound>(m, "Round")
             .def(pybind11::init<vertex_t, vertex_t, std::shared_ptr<PyTraveller>, std::shared_ptr<PyAdversary>, std::shared_ptr<PyBanValidator>, std::shared_ptr<PyStepValidator>>())
-            .def("run", &::ctpl::game::Round<vertex_t>::run);
+            .def("run", &::ctpl::game::Round<vertex_t>::run, "max_steps"_a = PyRound::NO_STEP_LIMIT)
+            .def("events", [](PyRound &round, std::size_t max_steps) {
+                return RoundEvents(round, max_steps);
+            }, "max_steps"_a = PyRound::NO_STEP_LIMIT, pybind11::keep_alive<0, 1>())
+            // binary trace of the round, see RoundTrace
+            .def("record", [](PyRound &round, std::uint64_t graph_id, std::uint64_t seed, std::size_t max_steps) {
+                auto data = round.record(graph_id, seed, max_steps).encode();
+                return pybind11::bytes(data.data(), data.size());
+            }, "graph_id"_a, "seed"_a, "max_steps"_a = PyRound::NO_STEP_LIMIT);
+
+    m.def("decodeTrace", [](const pybind11::bytes &data) {
+        return detail::toDict(::ctpl::game::RoundTrace<vertex_t>::decode(static_cast<std::string>(data)));
+    });
 }
@@ -0,0 +1,82 @@
+# Backends compared against DYNAMIC, run with the built module on the path:
+#   PYTHONPATH=<build>/ctpl_py python -m unittest discover ctpl_py/tests
+import unittest
+
+import ctpl_py as ctpl
+
+BACKENDS = [ctpl.BACKEND.DYNAMIC, ctpl.BACKEND.INDEXED, ctpl.BACKEND.MATRIX]
+
+
+def divided_builder():
+    # outer cycle 0 - 1 - 2 - 3 - 4 - 5 - 0, side A is 0, 1, 2, 3 and side B is 0, 5, 4, 3
+    builder = ctpl.GraphBuilder(ctpl.TYPES.DIVIDED_OUTERPLANAR)
+    for u, v in [(0, 1), (1, 2), (2, 3), (0, 5), (5, 4), (4, 3), (1, 5), (2, 5), (2, 4)]:
+        builder.withEdge(u, v)
+    return builder.withSideA([0, 1, 2, 3]).withSideB([0, 5, 4, 3])
+
+
+def edge_set(graph):
+    edges = set()
+    graph.visitAllEdges(lambda u, v, props: edges.add((min(u, v), max(u, v), props.get("weight"))))
+    return edges
+
+
+class DividedBackendsTest(unittest.TestCase):
+    def setUp(self):
+        self.graphs = {backend: ctpl.Graph(divided_builder(), backend) for backend in BACKENDS}
+        self.graphs["frozen"] = self.graphs[ctpl.BACKEND.DYNAMIC].freeze()
+        self.expected = self.graphs[ctpl.BACKEND.DYNAMIC]
+
+    def test_same_edges_and_sides(self):
+        for name, graph in self.graphs.items():
+            with self.subTest(backend=name):
+                self.assertEqual(edge_set(graph), edge_set(self.expected))
+                self.assertEqual(graph.sideA(), [0, 1, 2, 3])
+                self.assertEqual(graph.sideB(), [0, 5, 4, 3])
+
+    def test_side_and_chord_queries(self):
+        for name, graph in self.graphs.items():
+            with self.subTest(backend=name):
+                for u in range(-1, 8):
+                    self.assertEqual(graph.sidePosition(u), self.expected.sidePosition(u))
+                for side in [ctpl.SIDE.A, ctpl.SIDE.B]:
+                    for i in range(5):
+                        self.assertEqual(graph.nextChord(side, i), self.expected.nextChord(side, i))
+                        for j in range(i, 5):
+                            self.assertEqual(graph.chordsInRange(side, i, j), self.expected.chordsInRange(side, i, j))
+                self.assertEqual(len(graph.chordsInRange(ctpl.SIDE.A, 0, 4)), 3)
+
+    def test_only_dynamic_is_mutable(self):
+        dynamic = self.graphs[ctpl.BACKEND.DYNAMIC]
+        self.assertFalse(dynamic.isFrozen())
+        # crosses the chord (2, 5)
+        with self.assertRaises(ctpl.InvalidEdgeError):
+            dynamic.addEdge(1, 4, {})
+        for name in [ctpl.BACKEND.INDEXED, ctpl.BACKEND.MATRIX, "frozen"]:
+            with self.subTest(backend=name):
+                graph = self.graphs[name]
+                self.assertTrue(graph.isFrozen())
+                with self.assertRaises(ctpl.FrozenGraphError):
+                    graph.addEdge(1, 4, {})
+                with self.assertRaises(ctpl.FrozenGraphError):
+                    graph.removeEdge(1, 2)
+                self.assertEqual(edge_set(graph), edge_set(self.expected))
+
+
+class PlainBackendsTest(unittest.TestCase):
+    def test_shortest_paths(self):
+        builder = ctpl.GraphBuilder(ctpl.DIR.UNDIRECTED, ctpl.WEIGHT.WEIGHTED)
+        for u, v, w in [(0, 1, 4), (1, 2, 1), (0, 2, 7), (2, 3, 2), (1, 3, 6)]:
+            builder.withEdge(u, v, w)
+        graphs = [ctpl.Graph(builder, backend) for backend in BACKENDS]
+        for graph in graphs:
+            self.assertEqual(edge_set(graph), edge_set(graphs[0]))
+            for s in range(4):
+                for t in range(4):
+                    self.assertEqual(graph.shortestPathLength(s, t), graphs[0].shortestPathLength(s, t))
+        self.assertFalse(graphs[2].isFrozen())
+        self.assertTrue(graphs[1].isFrozen())
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,154 @@
+#include "GameTestsCommon.h"
+#include <ctpl/game/AdversarySolver.h>
+#include <ctpl/game/OptimalAdversary.h>
+#include <ctpl/game/Round.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <map>
+
+using namespace ctpl::game;
+
+namespace test {
+    using solver_props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+
+    inline GraphBuilder<vertex_t, solver_props_t> twoRoutes() {
+        GraphBuilder<vertex_t, solver_props_t> builder;
+        builder.withEdge(0, 1, weighted<solver_props_t>(1))
+                .withEdge(1, 3, weighted<solver_props_t>(1))
+                .withEdge(0, 2, weighted<solver_props_t>(5))
+                .withEdge(2, 3, weighted<solver_props_t>(5));
+        return builder;
+    }
+
+    // value iteration over all (position, banned set) states
+    inline std::int32_t bruteForceValue(const DynamicGraph<vertex_t, solver_props_t>& graph, vertex_t vertex_count,
+                                        vertex_t s, vertex_t t, std::size_t k) {
+        static constexpr std::int32_t INF = std::numeric_limits<std::int32_t>::max();
+        std::vector<std::pair<vertex_t, vertex_t>> edges;
+        graph.visitAllEdges([&](vertex_t u, vertex_t v, auto) { edges.push_back({u, v}); });
+
+        auto reachable = [&](vertex_t from, std::uint32_t banned) {
+            DynamicGraph<vertex_t, solver_props_t> copy = graph;
+            for (std::size_t e = 0; e < edges.size(); e++) {
+                if (banned >> e & 1) {
+                    copy.removeEdge(edges[e].first, edges[e].second);
+                }
+            }
+            return shortestPathLength(copy, from, t).has_value();
+        };
+
+        std::map<std::pair<vertex_t, std::uint32_t>, std::int32_t> tv, av;
+        std::vector<std::uint32_t> sets;
+        for (std::uint32_t b = 0; b < (1u << edges.size()); b++) {
+            if (std::popcount(b) <= k) {
+                sets.push_back(b);
+            }
+        }
+        for (auto b : sets) {
+            for (vertex_t p = 0; p < vertex_count; p++) {
+                tv[{p, b}] = p == t ? 0 : INF;
+                av[{p, b}] = p == t ? 0 : INF;
+            }
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto b : sets) {
+                for (vertex_t p = 0; p < vertex_count; p++) {
+                    if (p == t) {
+                        continue;
+                    }
+                    std::int32_t best = INF;
+                    for (std::size_t e = 0; e < edges.size(); e++) {
+                        if (b >> e & 1) {
+                            continue;
+                        }
+                        auto [x, y] = edges[e];
+                        if (x != p && y != p) {
+                            continue;
+                        }
+                        vertex_t q = x == p ? y : x;
+                        auto a = av[{q, b}];
+                        if (a != INF) {
+                            best = std::min(best, graph.getEdgeProps(x, y)->weight + a);
+                        }
+                    }
+                    changed |= best != tv[{p, b}];
+                    tv[{p, b}] = best;
+
+                    std::int32_t adv = tv[{p, b}];
+                    if (std::popcount(b) < k) {
+                        for (std::size_t e = 0; e < edges.size(); e++) {
+                            if (!(b >> e & 1) && reachable(p, b | (1u << e))) {
+                                adv = std::max(adv, av[{p, b | (1u << e)}]);
+                            }
+                        }
+                    }
+                    changed |= adv != av[{p, b}];
+                    av[{p, b}] = adv;
+                }
+            }
+        }
+        return tv[{s, 0}];
+    }
+}
+
+TEST(AdversarySolver, TwoRoutes) {
+    DynamicGraph<test::vertex_t, test::solver_props_t> graph = test::twoRoutes();
+    AdversarySolver solver(graph, 0, 3, 1);
+
+    auto res = solver.solve();
+    ASSERT_EQ(res.value, 12);
+    ASSERT_EQ(res.offline_optimum, 2);
+    ASSERT_DOUBLE_EQ(res.ratio, 6.0);
+
+    auto bans = solver.bestBans(1, {});
+    ASSERT_EQ(bans.size(), 1);
+    ASSERT_TRUE(bans[0] == std::pair(1, 3) || bans[0] == std::pair(3, 1));
+}
+
+TEST(AdversarySolver, NoBudget) {
+    DynamicGraph<test::vertex_t, test::solver_props_t> graph = test::twoRoutes();
+    ASSERT_EQ(AdversarySolver(graph, 0, 3, 0).solve().value, 2);
+}
+
+TEST(AdversarySolver, BruteForce_Random) {
+    static constexpr std::size_t VERTEX_COUNT = 6;
+
+    int times = 10;
+    while (times--) {
+        GraphBuilder<test::vertex_t, test::solver_props_t> builder;
+        std::size_t edge_count = 0;
+        test::iterateOverPossibleEdges<test::solver_props_t>(VERTEX_COUNT, [&](test::vertex_t u, test::vertex_t v) {
+            if (edge_count < 10 && test::rng()() % 2) {
+                test::solver_props_t props;
+                props.weight = 1 + static_cast<std::int32_t>(test::rng()() % 5);
+                builder.withEdge(u, v, props);
+                ++edge_count;
+            }
+        });
+        DynamicGraph<test::vertex_t, test::solver_props_t> graph = builder;
+        if (!shortestPathLength(graph, 0, 5)) {
+            continue;
+        }
+
+        for (std::size_t k = 0; k <= 2; k++) {
+            auto expected = test::bruteForceValue(graph, VERTEX_COUNT, 0, 5, k);
+            ASSERT_EQ(AdversarySolver(graph, 0, 5, k, {.threads = 1}).solve().value, expected);
+            ASSERT_EQ(AdversarySolver(graph, 0, 5, k, {.threads = 4}).solve().value, expected);
+        }
+    }
+}
+
+TEST(AdversarySolver, OptimalAdversaryInRound) {
+    DynamicGraph<test::vertex_t, test::solver_props_t> graph = test::twoRoutes();
+    AdversarySolver solver(graph, 0, 3, 1);
+    test::GreedyTraveller<test::solver_props_t> traveller(graph, 3);
+    test::KBanValidator<test::solver_props_t> ban_validator(traveller, graph, 1);
+    test::EdgeStepValidator<test::solver_props_t> step_validator(graph);
+    OptimalAdversary<test::vertex_t, test::solver_props_t> adversary(ban_validator, solver);
+
+    auto path = Round<test::vertex_t>(0, 3, traveller, adversary, ban_validator, step_validator).run();
+    ASSERT_EQ(path, (std::vector<test::vertex_t>{0, 1, 0, 2, 3}));
+    ASSERT_EQ(adversary.banned().size(), 1);
+}
@@ -8,17 +8,96 @@ TEST(ShortestPath, Simple) {
     using props_t = EdgeProps<Undirected, Weighted<weight_t>>;
     using builder = GraphBuilder<test::vertex_t, props_t>;
 
-    auto weightedEdge = [](weight_t w) {
-        props_t res;
-        res.weight = w;
-        return res;
-    };
-
     DynamicGraph<test::vertex_t, props_t> graph = builder()
-            .withEdge(1, 2, weightedEdge(5))
-            .withEdge(2, 4, weightedEdge(3))
-            .withEdge(1, 3, weightedEdge(1))
-            .withEdge(3, 4, weightedEdge(11));
+            .withEdge(1, 2, test::weighted<props_t>(5))
+            .withEdge(2, 4, test::weighted<props_t>(3))
+            .withEdge(1, 3, test::weighted<props_t>(1))
+            .withEdge(3, 4, test::weighted<props_t>(11));
 
     ASSERT_EQ(ctpl::dijkstra(graph, 1, 4), 8);
 }
+
+namespace test {
+    template<typename props_t>
+    DynamicGraph<vertex_t, props_t> randomWeightedGraph(std::size_t vertex_count, std::int32_t max_weight) {
+        auto matrix = generateRandomAdjacencyMatrix<props_t>(vertex_count);
+        GraphBuilder<vertex_t, props_t> builder;
+        iterateOverPossibleEdges<props_t>(vertex_count, [&](vertex_t u, vertex_t v) {
+            if (matrix[u][v]) {
+                props_t props;
+                props.weight = static_cast<std::int32_t>(rng()() % (max_weight + 1));
+                builder.withEdge(u, v, props);
+            }
+        });
+        return builder;
+    }
+
+    template<typename props_t>
+    void compareWithDijkstra(std::int32_t max_weight) {
+        static constexpr std::size_t VERTEX_COUNT = 20;
+
+        int times = 10;
+        while (times--) {
+            auto graph = randomWeightedGraph<props_t>(VERTEX_COUNT, max_weight);
+            auto dist = distances(graph, 0);
+            for (vertex_t v = 0; v < VERTEX_COUNT; v++) {
+                auto expected = dijkstra(graph, 0, v);
+                ASSERT_EQ(expected.has_value(), dist.contains(v));
+                if (expected) {
+                    ASSERT_EQ(*expected, dist[v]);
+                    ASSERT_EQ(*expected, shortestPathLength(graph, 0, v));
+                    auto path = shortestPath(graph, 0, v);
+                    ASSERT_EQ(path.front(), 0);
+                    ASSERT_EQ(path.back(), v);
+                    std::int32_t length = 0;
+                    for (std::size_t i = 0; i + 1 < path.size(); i++) {
+                        length += graph.getEdgeProps(path[i], path[i + 1])->weight;
+                    }
+                    ASSERT_EQ(length, *expected);
+                }
+            }
+        }
+    }
+}
+
+TEST(ShortestPath, UnweightedBfs) {
+    using props_t = EdgeProps<Undirected>;
+
+    DynamicGraph<test::vertex_t, props_t> graph = test::Builder<props_t>()
+            .withEdge(1, 2, {})
+            .withEdge(2, 3, {})
+            .withEdge(3, 4, {})
+            .withEdge(1, 5, {})
+            .withEdge(5, 4, {});
+
+    ASSERT_EQ(shortestPathLength(graph, 1, 4), 2);
+    ASSERT_EQ(shortestPath(graph, 1, 4), (std::vector<test::vertex_t>{1, 5, 4}));
+    ASSERT_FALSE(shortestPathLength(graph, 1, 42).has_value());
+}
+
+TEST(ShortestPath, ZeroOneBfs_Random) {
+    test::compareWithDijkstra<EdgeProps<Undirected, Weighted<std::int32_t>, MaxWeight<1>>>(1);
+}
+
+TEST(ShortestPath, FractionalMaxWeight) {
+    // fractional weights in [0, 1] are not 0/1 weights, the binary heap is used
+    auto check = []<typename props_t>(props_t, double scale) {
+        DynamicGraph<test::vertex_t, props_t> graph = test::Builder<props_t>()
+                .withEdge(0, 1, test::weighted<props_t>(0.5 * scale))
+                .withEdge(1, 2, test::weighted<props_t>(0.5 * scale))
+                .withEdge(0, 2, test::weighted<props_t>(0.9 * scale));
+        ASSERT_DOUBLE_EQ(*shortestPathLength(graph, 0, 2), 0.9 * scale);
+        ASSERT_DOUBLE_EQ(distances(graph, 0)[2], 0.9 * scale);
+        ASSERT_EQ(shortestPath(graph, 0, 2), (std::vector<test::vertex_t>{0, 2}));
+    };
+    check(EdgeProps<Undirected, Weighted<double>, MaxWeight<1>>(), 1);
+    check(EdgeProps<Undirected, Weighted<double>, MaxWeight<0.5>>(), 0.5);
+}
+
+TEST(ShortestPath, DialBuckets_Random) {
+    test::compareWithDijkstra<EdgeProps<Undirected, Weighted<std::int32_t>, MaxWeight<10>>>(10);
+}
+
+TEST(ShortestPath, BinaryHeap_Random) {
+    test::compareWithDijkstra<EdgeProps<Directed, Weighted<std::int32_t>>>(1000);
+}
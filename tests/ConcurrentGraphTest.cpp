@@ -0,0 +1,176 @@
+#include "TestsCommon.h"
+
+#include <ctpl/graph/ConcurrentGraph.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/algo.h>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <tuple>
+
+namespace test {
+    template<typename props_t>
+    void concurrentBuilding() {
+        detail::building<ConcurrentGraph<vertex_t, props_t>, props_t>();
+    };
+
+    template<typename props_t>
+    void concurrentVisitAllEdgesRandom() {
+        detail::visitAllEdgesRandom<ConcurrentGraph<vertex_t, props_t>, props_t>();
+    }
+
+    template<typename props_t>
+    void concurrentVisitAdjacentVerticesRandom() {
+        detail::visitAdjacentVerticesRandom<ConcurrentGraph<vertex_t, props_t>, props_t>();
+    }
+
+    template<typename props_t>
+    void applyMutationsRandom() {
+        static constexpr std::size_t VERTEX_COUNT = 10;
+        auto matrix = generateRandomAdjacencyMatrix<props_t>(VERTEX_COUNT);
+        GraphBuilder<vertex_t, props_t> builder;
+        iterateOverPossibleEdges<props_t>(VERTEX_COUNT, [&](vertex_t u, vertex_t v) {
+            if (matrix[u][v]) {
+                builder.withEdge(u, v, {});
+            }
+        });
+        ConcurrentGraph<vertex_t, props_t> graph = builder.withVertexCount(VERTEX_COUNT);
+        DynamicGraph<vertex_t, props_t> expected = builder;
+
+        auto edges = [](const IGraph<vertex_t, props_t>& g) {
+            std::set<std::tuple<vertex_t, vertex_t, int>> res;
+            g.visitAllEdges([&](vertex_t u, vertex_t v, props_t props) {
+                res.insert({u, v, props.weight});
+            });
+            return res;
+        };
+
+        for (int batch_count = 0; batch_count < 20; batch_count++) {
+            std::vector<Mutation<vertex_t, props_t>> batch;
+            for (int i = 0; i < 30; i++) {
+                vertex_t u = rng()() % VERTEX_COUNT;
+                vertex_t v = rng()() % VERTEX_COUNT;
+                if (u == v) {
+                    continue;
+                }
+                props_t props;
+                props.weight = static_cast<int>(rng()() % 10);
+                batch.push_back(rng()() % 2 ? Mutation<vertex_t, props_t>::addEdge(u, v, props)
+                                            : Mutation<vertex_t, props_t>::removeEdge(u, v));
+                if (batch.back().type == Mutation<vertex_t, props_t>::Type::ADD) {
+                    expected.addEdge(u, v, props);
+                } else {
+                    expected.removeEdge(u, v);
+                }
+            }
+            graph.applyMutations(batch);
+            ASSERT_EQ(edges(graph), edges(expected));
+        }
+    }
+}
+
+TEST(ConcurrentGraph, BuildingUndirected) {
+    test::concurrentBuilding<EdgeProps<Undirected>>();
+}
+
+TEST(ConcurrentGraph, BuildingDirected) {
+    test::concurrentBuilding<EdgeProps<Directed>>();
+}
+
+TEST(ConcurrentGraph, VisitAllEdges_Undirected_Random) {
+    test::concurrentVisitAllEdgesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(ConcurrentGraph, VisitAllEdges_Directed_Random) {
+    test::concurrentVisitAllEdgesRandom<EdgeProps<Directed>>();
+}
+
+TEST(ConcurrentGraph, VisitAdjacentVertices_Undirected_Random) {
+    test::concurrentVisitAdjacentVerticesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(ConcurrentGraph, VisitAdjacentVertices_Directed_Random) {
+    test::concurrentVisitAdjacentVerticesRandom<EdgeProps<Directed>>();
+}
+
+TEST(ConcurrentGraph, ApplyMutations_Undirected_Random) {
+    test::applyMutationsRandom<EdgeProps<Undirected, Weighted<int>>>();
+}
+
+TEST(ConcurrentGraph, ApplyMutations_Directed_Random) {
+    test::applyMutationsRandom<EdgeProps<Directed, Weighted<int>>>();
+}
+
+TEST(ConcurrentGraph, AddEdgeOutOfRange) {
+    using props_t = EdgeProps<Undirected>;
+    using mutation_t = Mutation<test::vertex_t, props_t>;
+    ConcurrentGraph<test::vertex_t, props_t> graph(4);
+    ASSERT_THROW(graph.addEdge(0, 4, {}), std::out_of_range);
+    ASSERT_THROW(graph.addEdge(-1, 0, {}), std::out_of_range);
+
+    // the batch is checked before anything is published
+    std::vector<mutation_t> batch = {mutation_t::addEdge(0, 1, {}), mutation_t::addEdge(2, 7, {})};
+    ASSERT_THROW(graph.applyMutations(batch), std::out_of_range);
+    ASSERT_FALSE(graph.isEdgeBelongs(0, 1));
+    graph.removeEdge(0, 7);
+}
+
+TEST(ConcurrentGraph, ReadersDuringBans) {
+    using props_t = EdgeProps<Undirected, Weighted<int>>;
+    static constexpr test::vertex_t VERTEX_COUNT = 64;
+
+    GraphBuilder<test::vertex_t, props_t> builder;
+    for (test::vertex_t u = 0; u + 1 < VERTEX_COUNT; u++) {
+        props_t props;
+        props.weight = 1;
+        builder.withEdge(u, u + 1, props);
+    }
+    ConcurrentGraph<test::vertex_t, props_t> graph = builder;
+
+    std::atomic<bool> done = false;
+    std::atomic<std::size_t> errors = 0;
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; r++) {
+        readers.emplace_back([&]() {
+            while (!done) {
+                for (test::vertex_t u = 0; u < VERTEX_COUNT; u++) {
+                    test::vertex_t last = -1;
+                    graph.visitAdjacentVertices(u, [&](test::vertex_t, test::vertex_t v, props_t props) {
+                        // every snapshot is sorted, chord weights are always 2, path weights 1
+                        if (v <= last || props.weight != (std::abs(v - u) == 1 ? 1 : 2)) {
+                            ++errors;
+                        }
+                        last = v;
+                    });
+                    // path edges are never touched
+                    if (u + 1 < VERTEX_COUNT && !graph.isEdgeBelongs(u, u + 1)) {
+                        ++errors;
+                    }
+                }
+            }
+        });
+    }
+
+    for (int step = 0; step < 20000; step++) {
+        test::vertex_t u = step % (VERTEX_COUNT - 2);
+        test::vertex_t v = u + 2 + step % 5;
+        if (v >= VERTEX_COUNT) {
+            continue;
+        }
+        if (graph.isEdgeBelongs(u, v)) {
+            graph.removeEdge(u, v);
+        } else {
+            props_t props;
+            props.weight = 2;
+            graph.addEdge(u, v, props);
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    graph.reclaim();
+
+    ASSERT_EQ(errors, 0);
+    ASSERT_EQ(shortestPathLength(graph, 0, VERTEX_COUNT - 1).has_value(), true);
+}
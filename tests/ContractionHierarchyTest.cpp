@@ -0,0 +1,131 @@
+#include "TestsCommon.h"
+#include <ctpl/game/outerplanar/DividedGenerator.h>
+#include <ctpl/graph/ContractionHierarchy.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/algo.h>
+
+namespace test {
+    template<typename props_t>
+    GraphBuilder<vertex_t, props_t> randomWeightedBuilder(std::size_t vertex_count) {
+        auto matrix = generateRandomAdjacencyMatrix<props_t>(vertex_count);
+        GraphBuilder<vertex_t, props_t> builder;
+        iterateOverPossibleEdges<props_t>(vertex_count, [&](vertex_t u, vertex_t v) {
+            // sparse enough to have long paths and shortcuts
+            if (matrix[u][v] && rng()() % 4 == 0) {
+                props_t props;
+                if constexpr (IsPropsWeighted<props_t>::value) {
+                    props.weight = static_cast<std::int32_t>(rng()() % 100);
+                }
+                builder.withEdge(u, v, props);
+            }
+        });
+        return builder.withVertexCount(vertex_count);
+    }
+
+    template<typename props_t>
+    void compareWithDijkstra(CustomizableContractionHierarchy<vertex_t, props_t>& cch,
+                             const DynamicGraph<vertex_t, props_t>& graph) {
+        for (vertex_t s = 0; s < cch.vertexCount(); s++) {
+            auto expected = distances(graph, s);
+            for (vertex_t t = 0; t < cch.vertexCount(); t++) {
+                auto length = cch.shortestPathLength(s, t);
+                ASSERT_EQ(expected.contains(t), length.has_value());
+                if (!length) {
+                    ASSERT_TRUE(cch.shortestPath(s, t).empty());
+                    continue;
+                }
+                ASSERT_EQ(expected[t], *length);
+                auto path = cch.shortestPath(s, t);
+                ASSERT_EQ(path.front(), s);
+                ASSERT_EQ(path.back(), t);
+                distance_t<props_t> walked = 0;
+                for (std::size_t i = 0; i + 1 < path.size(); i++) {
+                    auto props = graph.getEdgeProps(path[i], path[i + 1]);
+                    ASSERT_TRUE(props.has_value());
+                    walked += edgeLength(*props);
+                }
+                ASSERT_EQ(walked, *length);
+            }
+        }
+    }
+
+    template<typename props_t>
+    void bansRandom() {
+        static constexpr std::size_t VERTEX_COUNT = 40;
+        int times = 5;
+        while (times--) {
+            auto builder = randomWeightedBuilder<props_t>(VERTEX_COUNT);
+            DynamicGraph<vertex_t, props_t> graph = builder;
+            CustomizableContractionHierarchy<vertex_t, props_t> cch(builder);
+            compareWithDijkstra(cch, graph);
+
+            std::vector<std::pair<vertex_t, vertex_t>> banned;
+            for (const auto& e : builder.edges()) {
+                if (rng()() % 3 == 0 && graph.isEdgeBelongs(e.u, e.v)) {
+                    ASSERT_TRUE(cch.banEdge(e.u, e.v));
+                    ASSERT_TRUE(cch.isEdgeBanned(e.v, e.u));
+                    graph.removeEdge(e.u, e.v);
+                    banned.emplace_back(e.u, e.v);
+                }
+            }
+            compareWithDijkstra(cch, graph);
+
+            for (const auto& [u, v] : banned) {
+                ASSERT_TRUE(cch.unbanEdge(u, v));
+            }
+            compareWithDijkstra(cch, DynamicGraph<vertex_t, props_t>(builder));
+        }
+    }
+}
+
+TEST(ContractionHierarchy, Unweighted_Bans_Random) {
+    test::bansRandom<EdgeProps<Undirected>>();
+}
+
+TEST(ContractionHierarchy, Weighted_Bans_Random) {
+    test::bansRandom<EdgeProps<Undirected, Weighted<std::int32_t>>>();
+}
+
+TEST(ContractionHierarchy, SetWeight) {
+    using props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+    props_t w;
+    w.weight = 1;
+    GraphBuilder<test::vertex_t, props_t> builder;
+    // cycle 0 - 1 - 2 - 3 - 4 - 0
+    for (test::vertex_t u = 0; u < 5; u++) {
+        builder.withEdge(u, (u + 1) % 5, w);
+    }
+    CustomizableContractionHierarchy<test::vertex_t, props_t> cch(builder);
+    ASSERT_EQ(cch.shortestPathLength(0, 2), 2);
+    ASSERT_TRUE(cch.setWeight(1, 2, 10));
+    ASSERT_EQ(cch.shortestPathLength(0, 2), 3);
+    ASSERT_EQ(cch.shortestPath(0, 2), (std::vector<test::vertex_t>{0, 4, 3, 2}));
+    ASSERT_TRUE(cch.banEdge(3, 4));
+    ASSERT_EQ(cch.shortestPathLength(0, 2), 11);
+    ASSERT_TRUE(cch.banEdge(0, 1));
+    ASSERT_FALSE(cch.shortestPathLength(0, 2).has_value());
+    ASSERT_FALSE(cch.setWeight(0, 2, 1));
+    ASSERT_TRUE(cch.unbanEdge(0, 1));
+    ASSERT_EQ(cch.shortestPathLength(0, 2), 11);
+}
+
+TEST(ContractionHierarchy, DividedOuterplanar) {
+    using namespace ctpl::game;
+    auto builder = generateDividedOuterplanar({.vertex_count = 300, .chord_density = 0.6, .seed = 5});
+    DynamicGraph<default_vertex_t, outerplanar_props_t> graph = builder;
+    CustomizableContractionHierarchy<default_vertex_t, outerplanar_props_t> cch(builder);
+    // small separators keep the hierarchy sparse
+    ASSERT_LE(cch.arcCount(), 4 * builder.edges().size());
+
+    default_vertex_t s = builder.sideA().front();
+    default_vertex_t t = builder.sideB().back();
+    for (std::size_t i = 1; i < 20; i++) {
+        auto path = shortestPath(graph, s, t);
+        ASSERT_EQ(shortestPathLength(graph, s, t), cch.shortestPathLength(s, t));
+        if (path.size() < 2) {
+            break;
+        }
+        graph.removeEdge(path[path.size() / 2 - 1], path[path.size() / 2]);
+        cch.banEdge(path[path.size() / 2 - 1], path[path.size() / 2]);
+    }
+}
@@ -0,0 +1,67 @@
+#include "TestsCommon.h"
+#include <ctpl/game/outerplanar/DividedGenerator.h>
+#include <ctpl/game/outerplanar/DividedGraph.h>
+#include <ctpl/graph/algo.h>
+#include <set>
+
+using namespace ctpl::game;
+
+namespace test {
+    inline bool sameInstance(const DividedOuterplanarBuilder& lhs, const DividedOuterplanarBuilder& rhs) {
+        if (lhs.sideA() != rhs.sideA() || lhs.sideB() != rhs.sideB() || lhs.edges().size() != rhs.edges().size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs.edges().size(); i++) {
+            const auto& a = lhs.edges()[i];
+            const auto& b = rhs.edges()[i];
+            if (a.u != b.u || a.v != b.v || a.weight != b.weight) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(DividedGenerator, PassesValidation) {
+    for (std::size_t n : {3, 4, 5, 10, 100, 1000}) {
+        for (double density : {0.0, 0.3, 1.0}) {
+            for (std::uint64_t seed = 0; seed < 10; seed++) {
+                auto builder = generateDividedOuterplanar({.vertex_count = n, .chord_density = density, .seed = seed});
+                ASSERT_TRUE(builder.isTrusted());
+                ASSERT_EQ(builder.sideA().size() + builder.sideB().size(), n + 2);
+                builder.withTrusted(false);
+                ASSERT_NO_THROW(DividedOuterplanarGraph{builder});
+            }
+        }
+    }
+}
+
+TEST(DividedGenerator, Weights) {
+    auto builder = generateDividedOuterplanar({.vertex_count = 1000, .min_weight = 3, .max_weight = 7, .seed = 1});
+    std::set<weight_t> weights;
+    for (const auto& e : builder.edges()) {
+        weights.insert(e.weight);
+    }
+    ASSERT_EQ(weights, (std::set<weight_t>{3, 4, 5, 6, 7}));
+}
+
+TEST(DividedGenerator, Deterministic) {
+    DividedOuterplanarGeneratorOptions options{.vertex_count = 500, .seed = 42};
+    ASSERT_TRUE(test::sameInstance(generateDividedOuterplanar(options), generateDividedOuterplanar(options)));
+
+    auto sequential = generateDividedOuterplanarMany(options, 16, 1);
+    auto parallel = generateDividedOuterplanarMany(options, 16, 4);
+    ASSERT_EQ(sequential.size(), 16);
+    for (std::size_t i = 0; i < sequential.size(); i++) {
+        ASSERT_TRUE(test::sameInstance(sequential[i], parallel[i]));
+    }
+    ASSERT_FALSE(test::sameInstance(sequential[0], sequential[1]));
+}
+
+TEST(DividedGenerator, Large) {
+    auto builder = generateDividedOuterplanar({.vertex_count = 200'000, .chord_density = 1.0, .seed = 7});
+    // every step of the chord walk places a chord
+    ASSERT_EQ(builder.edges().size(), 200'000 + (builder.sideA().size() - 2) + (builder.sideB().size() - 2) - 1);
+    DividedOuterplanarGraph graph = builder;
+    ASSERT_TRUE(shortestPathLength(graph, builder.sideA().front(), builder.sideA().back()).has_value());
+}
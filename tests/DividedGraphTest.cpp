@@ -0,0 +1,204 @@
+#include "GameTestsCommon.h"
+#include <ctpl/game/outerplanar/DividedGenerator.h>
+#include <ctpl/game/outerplanar/DividedGraph.h>
+#include <unordered_map>
+
+using namespace ctpl::game;
+
+namespace test {
+    inline DividedOuterplanarBuilder dividedBuilder() {
+        outerplanar_props_t w;
+        w.weight = 1;
+        DividedOuterplanarBuilder builder;
+        builder.withEdge(1, 2, w).withEdge(2, 3, w).withEdge(3, 4, w).withEdge(4, 5, w).withEdge(5, 9, w)
+                .withEdge(1, 6, w).withEdge(6, 7, w).withEdge(7, 8, w).withEdge(8, 9, w)
+                .withEdge(2, 4, w).withEdge(5, 6, w).withEdge(6, 8, w);
+        builder.withSideAVec({1, 2, 3, 4, 5, 9});
+        builder.withSideBVec({1, 6, 7, 8, 9});
+        return builder;
+    }
+}
+
+TEST(DividedGraph, Valid) {
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    ASSERT_TRUE(graph.isEdgeBelongs(5, 6));
+    ASSERT_EQ(graph.sideA().size(), 6);
+}
+
+TEST(DividedGraph, K4IsRejected) {
+    auto builder = test::dividedBuilder();
+    outerplanar_props_t w;
+    w.weight = 1;
+    builder.withEdge(2, 5, w).withEdge(3, 5, w);
+    ASSERT_THROW(DividedOuterplanarGraph{builder}, DividedOuterplanarGraph::BuildException);
+}
+
+TEST(DividedGraph, K23IsRejected) {
+    auto builder = test::dividedBuilder();
+    outerplanar_props_t w;
+    w.weight = 1;
+    builder.withEdge(2, 5, w).withEdge(2, 7, w).withEdge(4, 7, w);
+    ASSERT_THROW(DividedOuterplanarGraph{builder}, DividedOuterplanarGraph::BuildException);
+}
+
+TEST(DividedGraph, SidesMustShareEndpoints) {
+    auto builder = test::dividedBuilder();
+    builder.withSideAVec({2});
+    ASSERT_THROW(DividedOuterplanarGraph{builder}, DividedOuterplanarGraph::BuildException);
+}
+
+TEST(DividedGraph, AddEdgeKeepsOuterplanarity) {
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    outerplanar_props_t w;
+    w.weight = 3;
+
+    // crosses 2 - 4
+    ASSERT_FALSE(graph.canAddEdge(3, 6));
+    ASSERT_THROW(graph.addEdge(3, 6, w), DividedOuterplanarGraph::InvalidEdgeException);
+    ASSERT_FALSE(graph.isEdgeBelongs(3, 6));
+    // not on the sides
+    ASSERT_THROW(graph.addEdge(3, 100, w), DividedOuterplanarGraph::InvalidEdgeException);
+
+    graph.addEdge(4, 6, w);
+    ASSERT_EQ(graph.getEdgeProps(6, 4)->weight, 3);
+    ASSERT_FALSE(graph.tryAddEdge(3, 7, w));
+
+    graph.removeEdge(2, 4);
+    graph.removeEdge(4, 6);
+    ASSERT_TRUE(graph.tryAddEdge(3, 6, w));
+}
+
+TEST(DividedGraph, AddEdge_Random) {
+    for (std::uint64_t seed = 0; seed < 20; seed++) {
+        auto builder = generateDividedOuterplanar({.vertex_count = 25, .chord_density = 0.3, .seed = seed});
+        DividedOuterplanarGraph graph = builder;
+
+        std::unordered_map<default_vertex_t, std::size_t> pos;
+        for (std::size_t i = 0; i < graph.sideA().size(); i++) {
+            pos[graph.sideA()[i]] = i;
+        }
+        for (std::size_t j = 1; j + 1 < graph.sideB().size(); j++) {
+            pos[graph.sideB()[j]] = graph.sideA().size() - 1 + graph.sideB().size() - 1 - j;
+        }
+        auto crosses = [&](default_vertex_t u, default_vertex_t v) {
+            auto [a, b] = std::minmax(pos[u], pos[v]);
+            bool res = false;
+            graph.visitAllEdges([&](default_vertex_t x, default_vertex_t y, auto) {
+                auto inside = [&](default_vertex_t z) { return a < pos[z] && pos[z] < b; };
+                auto outside = [&](default_vertex_t z) { return pos[z] < a || b < pos[z]; };
+                res |= (inside(x) && outside(y)) || (inside(y) && outside(x));
+            });
+            return res;
+        };
+
+        for (int step = 0; step < 200; step++) {
+            auto u = static_cast<default_vertex_t>(test::rng()() % 25);
+            auto v = static_cast<default_vertex_t>(test::rng()() % 25);
+            if (test::rng()() % 4 == 0) {
+                graph.removeEdge(u, v);
+                continue;
+            }
+            outerplanar_props_t w;
+            w.weight = 1;
+            ASSERT_EQ(graph.tryAddEdge(u, v, w), !crosses(u, v));
+        }
+    }
+}
+
+TEST(DividedGraph, SidePosition) {
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    ASSERT_EQ(graph.sidePosition(3)->side, Side::A);
+    ASSERT_EQ(graph.sidePosition(3)->index, 2);
+    ASSERT_EQ(graph.sidePosition(7)->side, Side::B);
+    ASSERT_EQ(graph.sidePosition(7)->index, 2);
+    ASSERT_EQ(graph.sidePosition(9)->side, Side::A);
+    ASSERT_EQ(graph.sidePosition(9)->index, 5);
+    ASSERT_FALSE(graph.sidePosition(100));
+}
+
+TEST(DividedGraph, ChordIndex) {
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    outerplanar_props_t w;
+    w.weight = 1;
+    ASSERT_TRUE(graph.isChord(6, 5));
+    ASSERT_FALSE(graph.isChord(2, 4));
+    ASSERT_FALSE(graph.isChord(1, 6));
+    ASSERT_EQ(graph.chords().size(), 1);
+
+    graph.addEdge(4, 6, w);
+    auto chords = graph.chords();
+    ASSERT_EQ(chords.size(), 2);
+    ASSERT_EQ(chords[0].a, 4);
+    ASSERT_EQ(chords[0].b, 6);
+    ASSERT_EQ(chords[1].a, 5);
+    ASSERT_EQ(chords[1].a_index, 4);
+    ASSERT_EQ(chords[1].b_index, 1);
+
+    ASSERT_EQ(graph.nextChord(Side::A, 0)->a, 4);
+    ASSERT_EQ(graph.nextChord(Side::A, 3)->a, 5);
+    ASSERT_FALSE(graph.nextChord(Side::A, 4));
+    ASSERT_EQ(graph.nextChord(Side::B, 0)->a, 4);
+    ASSERT_FALSE(graph.nextChord(Side::B, 1));
+    ASSERT_EQ(graph.chordsInRange(Side::B, 1, 2).size(), 2);
+    ASSERT_TRUE(graph.chordsInRange(Side::A, 0, 3).empty());
+
+    graph.removeEdge(5, 6);
+    ASSERT_EQ(graph.chords().size(), 1);
+    ASSERT_FALSE(graph.isChord(5, 6));
+}
+
+TEST(DividedGraph, ApplyMutations) {
+    using mutation_t = Mutation<default_vertex_t, outerplanar_props_t>;
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    outerplanar_props_t w;
+    w.weight = 1;
+
+    ASSERT_FALSE(graph.canAddEdge(4, 8));
+    std::vector<mutation_t> batch = {mutation_t::removeEdge(5, 6), mutation_t::addEdge(5, 8, w)};
+    graph.applyMutations(batch);
+    ASSERT_FALSE(graph.isEdgeBelongs(5, 6));
+    ASSERT_FALSE(graph.isChord(5, 6));
+    auto chords = graph.chords();
+    ASSERT_EQ(chords.size(), 1);
+    ASSERT_EQ(chords[0].a, 5);
+    ASSERT_EQ(chords[0].b, 8);
+    ASSERT_TRUE(graph.canAddEdge(4, 8));
+    ASSERT_FALSE(graph.canAddEdge(9, 6));
+
+    // a crossing ADD rejects the whole batch
+    batch = {mutation_t::removeEdge(2, 4), mutation_t::addEdge(3, 7, w)};
+    ASSERT_THROW(graph.applyMutations(batch), DividedOuterplanarGraph::InvalidEdgeException);
+    ASSERT_TRUE(graph.isEdgeBelongs(2, 4));
+    ASSERT_FALSE(graph.isEdgeBelongs(3, 7));
+}
+
+TEST(DividedGraph, ApplyMutationsCrossingWithinBatch) {
+    using mutation_t = Mutation<default_vertex_t, outerplanar_props_t>;
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    outerplanar_props_t w;
+    w.weight = 1;
+    ASSERT_TRUE(graph.canAddEdge(5, 8));
+    ASSERT_TRUE(graph.canAddEdge(9, 6));
+
+    std::vector<mutation_t> batch = {mutation_t::addEdge(5, 8, w), mutation_t::addEdge(9, 6, w)};
+    ASSERT_THROW(graph.applyMutations(batch), DividedOuterplanarGraph::InvalidEdgeException);
+    ASSERT_FALSE(graph.isEdgeBelongs(5, 8));
+    ASSERT_TRUE(graph.canAddEdge(9, 6));
+}
+
+TEST(DividedGraph, BatchBans) {
+    using Edges = std::vector<std::pair<default_vertex_t, default_vertex_t>>;
+    DividedOuterplanarGraph graph = test::dividedBuilder();
+    test::GreedyTraveller<outerplanar_props_t, default_vertex_t> traveller(graph, 9);
+    test::KBanValidator<outerplanar_props_t, default_vertex_t> ban_validator(traveller, graph, 2);
+
+    Edges bans = {{5, 6}, {3, 7}, {2, 4}};
+    ASSERT_EQ(ban_validator.requestBanEdges(bans), (std::vector<bool>{true, false, true}));
+    ASSERT_FALSE(graph.isEdgeBelongs(5, 6));
+    ASSERT_FALSE(graph.isEdgeBelongs(4, 2));
+    ASSERT_TRUE(graph.chords().empty());
+    ASSERT_FALSE(graph.nextChord(Side::B, 0));
+    // the partner ranges no longer see the banned chord
+    ASSERT_TRUE(graph.canAddEdge(4, 8));
+    ASSERT_TRUE(graph.canAddEdge(1, 3));
+}
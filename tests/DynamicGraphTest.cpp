@@ -44,3 +44,43 @@ TEST(DynamicGraph, VisitAdjacentVertices_Undirected_Random) {
 TEST(DynamicGraph, VisitAdjacentVertices_Directed_Random) {
     test::visitAdjacentVerticesRandom<EdgeProps<Directed>>();
 }
+
+TEST(DynamicGraph, RemoveEdgeOfUnknownVertex) {
+    DynamicGraph<test::vertex_t, EdgeProps<Undirected>> graph = GraphBuilder<test::vertex_t, EdgeProps<Undirected>>()
+            .withEdge(0, 1, {});
+    auto before = graph.memoryUsage().total();
+    for (test::vertex_t u = 100; u < 200; u++) {
+        graph.removeEdge(u, u + 1);
+    }
+    ASSERT_EQ(graph.memoryUsage().total(), before);
+}
+
+TEST(DynamicGraph, CompactAfterRemovals) {
+    using props_t = EdgeProps<Undirected, Weighted<int>>;
+    static constexpr test::vertex_t VERTEX_COUNT = 1000;
+
+    GraphBuilder<test::vertex_t, props_t> builder;
+    for (test::vertex_t u = 0; u < VERTEX_COUNT; u++) {
+        for (test::vertex_t v = u + 1; v < std::min(u + 20, VERTEX_COUNT); v++) {
+            builder.withEdge(u, v, {});
+        }
+    }
+    DynamicGraph<test::vertex_t, props_t> graph = builder;
+    auto full = graph.memoryUsage();
+    ASSERT_GT(full.total(), 0);
+    ASSERT_EQ(full.components.size(), 3);
+
+    for (test::vertex_t u = 0; u < VERTEX_COUNT; u++) {
+        for (test::vertex_t v = u + 1; v < std::min(u + 20, VERTEX_COUNT); v++) {
+            if (u >= 10 || v != u + 1) {
+                graph.removeEdge(u, v);
+            }
+        }
+    }
+    graph.compact();
+    ASSERT_LT(graph.memoryUsage().total(), full.total() / 10);
+    for (test::vertex_t u = 0; u < 10; u++) {
+        ASSERT_TRUE(graph.isEdgeBelongs(u, u + 1));
+    }
+    ASSERT_FALSE(graph.isEdgeBelongs(10, 11));
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "TestsCommon.h"
+#include <ctpl/game/IAdversary.h>
+#include <ctpl/game/IBanValidator.h>
+#include <ctpl/game/IStepValidator.h>
+#include <ctpl/game/ITraveller.h>
+#include <ctpl/graph/IDynamicGraph.h>
+#include <ctpl/graph/algo.h>
+#include <algorithm>
+#include <span>
+
+namespace test {
+    template<typename props_t, typename graph_vertex_t = vertex_t>
+    class GreedyTraveller : public game::ITraveller<graph_vertex_t> {
+    public:
+        GreedyTraveller(const IGraph<graph_vertex_t, props_t>& graph, graph_vertex_t target)
+                : graph_(graph), target_(target) {
+        }
+
+        graph_vertex_t makeStep(graph_vertex_t current_vertex) override {
+            return shortestPath(graph_, current_vertex, target_).at(1);
+        }
+
+    private:
+        const IGraph<graph_vertex_t, props_t>& graph_;
+        graph_vertex_t target_;
+    };
+
+    template<typename props_t>
+    class EdgeStepValidator : public game::IStepValidator<vertex_t> {
+    public:
+        explicit EdgeStepValidator(const IGraph<vertex_t, props_t>& graph) : graph_(graph) {
+        }
+
+        bool validateStep(vertex_t u, vertex_t v) override {
+            return graph_.isEdgeBelongs(u, v);
+        }
+
+    private:
+        const IGraph<vertex_t, props_t>& graph_;
+    };
+
+    template<typename props_t, typename graph_vertex_t = vertex_t>
+    class KBanValidator : public game::IBanValidator<graph_vertex_t> {
+    public:
+        KBanValidator(game::ITraveller<graph_vertex_t>& traveller, IDynamicGraph<graph_vertex_t, props_t>& graph,
+                      std::size_t k)
+                : game::IBanValidator<graph_vertex_t>(traveller), graph_(graph), k_(k) {
+        }
+
+    protected:
+        bool tryRemoveEdge(graph_vertex_t u, graph_vertex_t v) override {
+            if (k_ == 0 || !graph_.isEdgeBelongs(u, v)) {
+                return false;
+            }
+            --k_;
+            graph_.removeEdge(u, v);
+            return true;
+        }
+
+        std::vector<bool> tryRemoveEdges(std::span<const std::pair<graph_vertex_t, graph_vertex_t>> edges) override {
+            std::vector<bool> res;
+            std::vector<Mutation<graph_vertex_t, props_t>> removals;
+            for (const auto& [u, v] : edges) {
+                bool repeated = std::any_of(removals.begin(), removals.end(), [&](const auto& m) {
+                    return (m.u == u && m.v == v) || (has_prop<Undirected, props_t> && m.u == v && m.v == u);
+                });
+                res.push_back(k_ != 0 && !repeated && graph_.isEdgeBelongs(u, v));
+                if (res.back()) {
+                    --k_;
+                    removals.push_back(Mutation<graph_vertex_t, props_t>::removeEdge(u, v));
+                }
+            }
+            graph_.applyMutations(removals);
+            return res;
+        }
+
+    private:
+        IDynamicGraph<graph_vertex_t, props_t>& graph_;
+        std::size_t k_;
+    };
+}
@@ -0,0 +1,83 @@
+#include "TestsCommon.h"
+
+#include <ctpl/graph/IndexedGraph.h>
+#include <ctpl/graph/IndexedGraphView.h>
+
+namespace test {
+    template<typename props_t>
+    void indexedBuilding() {
+        detail::building<IndexedGraph<vertex_t, props_t>, props_t>();
+    };
+
+    template<typename props_t>
+    void indexedVisitAllEdgesRandom() {
+        detail::visitAllEdgesRandom<IndexedGraph<vertex_t, props_t>, props_t>();
+    }
+
+    template<typename props_t>
+    void indexedVisitAdjacentVerticesRandom() {
+        detail::visitAdjacentVerticesRandom<IndexedGraph<vertex_t, props_t>, props_t>();
+    }
+}
+
+TEST(IndexedGraph, BuildingUndirected) {
+    test::indexedBuilding<EdgeProps<Undirected>>();
+}
+
+TEST(IndexedGraph, BuildingDirected) {
+    test::indexedBuilding<EdgeProps<Directed>>();
+}
+
+TEST(IndexedGraph, VisitAllEdges_Undirected_Random) {
+    test::indexedVisitAllEdgesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(IndexedGraph, VisitAllEdges_Directed_Random) {
+    test::indexedVisitAllEdgesRandom<EdgeProps<Directed>>();
+}
+
+TEST(IndexedGraph, VisitAdjacentVertices_Undirected_Random) {
+    test::indexedVisitAdjacentVerticesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(IndexedGraph, VisitAdjacentVertices_Directed_Random) {
+    test::indexedVisitAdjacentVerticesRandom<EdgeProps<Directed>>();
+}
+
+TEST(IndexedGraph, WeightedEdgeProps) {
+    using props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+    props_t w;
+    w.weight = 7;
+
+    IndexedGraph<test::vertex_t, props_t> graph = test::Builder<props_t>().withEdge(0, 3, w);
+
+    ASSERT_EQ(graph.vertexCount(), 4);
+    ASSERT_EQ(graph.getEdgeProps(3, 0)->weight, 7);
+    ASSERT_FALSE(graph.getEdgeProps(1, 2).has_value());
+}
+
+TEST(IndexedGraph, ViewOverCopiedArrays) {
+    using props_t = EdgeProps<Directed, Weighted<std::int32_t>>;
+    IndexedGraph<test::vertex_t, props_t> graph = test::Builder<props_t>()
+            .withEdge(0, 3, test::weighted<props_t>(7))
+            .withEdge(0, 1, test::weighted<props_t>(2))
+            .withEdge(2, 0, test::weighted<props_t>(5));
+
+    // e.g. arrays copied to a shared memory segment
+    std::vector<std::size_t> offsets(graph.offsets().begin(), graph.offsets().end());
+    std::vector<test::vertex_t> targets(graph.targets().begin(), graph.targets().end());
+    std::vector<PackedProps<props_t>> props(graph.packedProps().begin(), graph.packedProps().end());
+    IndexedGraphView<test::vertex_t, props_t> view(offsets, targets, props);
+
+    ASSERT_EQ(view.vertexCount(), 4);
+    ASSERT_EQ(view.getEdgeProps(0, 3)->weight, 7);
+    ASSERT_EQ(view.getEdgeProps(2, 0)->weight, 5);
+    ASSERT_FALSE(view.isEdgeBelongs(3, 0));
+    ASSERT_EQ(view.adjacentVertices(0).size(), 2);
+    std::size_t edges = 0;
+    view.visitAllEdges([&](test::vertex_t u, test::vertex_t v, props_t p) {
+        ASSERT_EQ(graph.getEdgeProps(u, v)->weight, p.weight);
+        ++edges;
+    });
+    ASSERT_EQ(edges, 3);
+}
@@ -0,0 +1,60 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/intersect.h>
+#include <algorithm>
+#include <iterator>
+#include <set>
+
+namespace test {
+    template<typename T>
+    std::vector<T> randomSortedUnique(std::size_t max_size, T max_value) {
+        std::set<T> values;
+        std::size_t size = rng()() % (max_size + 1);
+        while (values.size() < size) {
+            values.insert(static_cast<T>(rng()() % max_value));
+        }
+        return {values.begin(), values.end()};
+    }
+
+    template<typename T>
+    void intersectionRandom() {
+        int times = 1000;
+        while (times--) {
+            auto a = randomSortedUnique<T>(60, 100);
+            auto b = randomSortedUnique<T>(60, 100);
+            std::vector<T> expected;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+
+            std::vector<T> actual(std::min(a.size(), b.size()));
+            actual.resize(sortedIntersection(std::span<const T>(a), std::span<const T>(b), actual.data()));
+            ASSERT_EQ(expected, actual);
+            ASSERT_EQ(expected.size(), sortedIntersectionSize(std::span<const T>(a), std::span<const T>(b)));
+        }
+    }
+}
+
+TEST(Intersect, Uint32_Random) {
+    test::intersectionRandom<std::uint32_t>();
+}
+
+TEST(Intersect, Int32_Random) {
+    test::intersectionRandom<std::int32_t>();
+}
+
+TEST(Intersect, Uint64_Random) {
+    test::intersectionRandom<std::uint64_t>();
+}
+
+TEST(Intersect, CommonNeighbours) {
+    using props_t = EdgeProps<Undirected>;
+    IndexedGraph<test::vertex_t, props_t> graph = test::Builder<props_t>()
+            .withEdge(0, 2, {})
+            .withEdge(0, 3, {})
+            .withEdge(0, 4, {})
+            .withEdge(1, 3, {})
+            .withEdge(1, 4, {})
+            .withEdge(1, 5, {});
+
+    ASSERT_EQ(commonNeighboursCount(graph, 0, 1), 2);
+    ASSERT_EQ(commonNeighbours(graph, 0, 1), (std::vector<test::vertex_t>{3, 4}));
+    ASSERT_EQ(commonNeighboursCount(graph, 0, 5), 0);
+}
@@ -0,0 +1,106 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/JournaledGraph.h>
+#include <ctpl/graph/MatrixGraph.h>
+#include <ctpl/graph/algo.h>
+#include <set>
+#include <tuple>
+
+namespace test {
+    using journal_props_t = EdgeProps<Undirected, Weighted<int>>;
+
+    template<typename graph_t>
+    std::set<std::tuple<vertex_t, vertex_t, int>> edgeSet(const graph_t& graph) {
+        std::set<std::tuple<vertex_t, vertex_t, int>> res;
+        graph.visitAllEdges([&](vertex_t u, vertex_t v, journal_props_t props) {
+            res.insert({std::min(u, v), std::max(u, v), props.weight});
+        });
+        return res;
+    }
+
+    template<typename graph_t>
+    void rollbackRandom(bool batched = false) {
+        static constexpr std::size_t VERTEX_COUNT = 12;
+
+        GraphBuilder<vertex_t, journal_props_t> builder;
+        builder.withVertexCount(VERTEX_COUNT);
+        iterateOverPossibleEdges<journal_props_t>(VERTEX_COUNT, [&](vertex_t u, vertex_t v) {
+            if (rng()() % 2) {
+                builder.withEdge(u, v, weighted<journal_props_t>(1 + rng()() % 10));
+            }
+        });
+        JournaledGraph<graph_t> graph = builder;
+
+        std::vector<std::pair<typename JournaledGraph<graph_t>::checkpoint_t, decltype(edgeSet(graph))>> states;
+        std::vector<Mutation<vertex_t, journal_props_t>> batch;
+        for (int step = 0; step < 200; step++) {
+            if (step % 10 == 0) {
+                graph.applyMutations(batch);
+                batch.clear();
+                states.push_back({graph.checkpoint(), edgeSet(graph)});
+            }
+            // a few sources in batched mode so that a batch touches an edge several times
+            vertex_t u = rng()() % (batched ? 4 : VERTEX_COUNT);
+            vertex_t v = rng()() % VERTEX_COUNT;
+            if (u == v) {
+                continue;
+            }
+            if (batched) {
+                auto w = weighted<journal_props_t>(1 + rng()() % 10);
+                batch.push_back(rng()() % 2 ? Mutation<vertex_t, journal_props_t>::addEdge(u, v, w)
+                                            : Mutation<vertex_t, journal_props_t>::removeEdge(u, v));
+            } else if (rng()() % 2) {
+                graph.addEdge(u, v, weighted<journal_props_t>(1 + rng()() % 10));
+            } else {
+                graph.removeEdge(u, v);
+            }
+        }
+        graph.applyMutations(batch);
+
+        while (!states.empty()) {
+            graph.rollback(states.back().first);
+            ASSERT_EQ(edgeSet(graph), states.back().second);
+            states.pop_back();
+        }
+        ASSERT_EQ(graph.journalSize(), 0);
+    }
+}
+
+TEST(JournaledGraph, Rollback) {
+    JournaledGraph<DynamicGraph<test::vertex_t, test::journal_props_t>> graph =
+            GraphBuilder<test::vertex_t, test::journal_props_t>()
+                    .withEdge(0, 1, test::weighted<test::journal_props_t>(1))
+                    .withEdge(1, 2, test::weighted<test::journal_props_t>(1))
+                    .withEdge(0, 2, test::weighted<test::journal_props_t>(5));
+
+    auto cp = graph.checkpoint();
+    graph.removeEdge(2, 1);
+    graph.removeEdge(3, 4);
+    graph.addEdge(0, 2, test::weighted<test::journal_props_t>(7));
+    ASSERT_EQ(graph.journalSize(), 2);
+    ASSERT_EQ(shortestPathLength(graph, 0, 2), 7);
+
+    graph.rollback(cp);
+    ASSERT_EQ(shortestPathLength(graph, 0, 2), 2);
+    ASSERT_EQ(graph.getEdgeProps(0, 2)->weight, 5);
+    ASSERT_TRUE(graph.isEdgeBelongs(1, 2));
+}
+
+TEST(JournaledGraph, Rollback_Dynamic_Random) {
+    for (int times = 0; times < 10; times++) {
+        test::rollbackRandom<DynamicGraph<test::vertex_t, test::journal_props_t>>();
+    }
+}
+
+TEST(JournaledGraph, Rollback_Matrix_Random) {
+    for (int times = 0; times < 10; times++) {
+        test::rollbackRandom<MatrixGraph<test::vertex_t, test::journal_props_t>>();
+    }
+}
+
+TEST(JournaledGraph, Rollback_Batched_Random) {
+    for (int times = 0; times < 10; times++) {
+        test::rollbackRandom<DynamicGraph<test::vertex_t, test::journal_props_t>>(true);
+        test::rollbackRandom<MatrixGraph<test::vertex_t, test::journal_props_t>>(true);
+    }
+}
@@ -0,0 +1,100 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/KShortestPaths.h>
+#include <ctpl/graph/DynamicGraph.h>
+
+namespace test {
+    template<typename props_t>
+    void allSimplePathLengths(const IGraph<vertex_t, props_t>& graph, vertex_t u, vertex_t target,
+                              std::vector<bool>& on_path, distance_t<props_t> length,
+                              std::vector<distance_t<props_t>>& res) {
+        if (u == target) {
+            res.push_back(length);
+            return;
+        }
+        on_path[u] = true;
+        graph.visitAdjacentVertices(u, [&](vertex_t, vertex_t v, props_t props) {
+            if (!on_path[v]) {
+                allSimplePathLengths(graph, v, target, on_path, length + edgeLength(props), res);
+            }
+        });
+        on_path[u] = false;
+    }
+
+    template<typename props_t>
+    void compareWithBruteForce() {
+        static constexpr std::size_t VERTEX_COUNT = 7;
+        int times = 20;
+        while (times--) {
+            auto matrix = generateRandomAdjacencyMatrix<props_t>(VERTEX_COUNT);
+            GraphBuilder<vertex_t, props_t> builder;
+            iterateOverPossibleEdges<props_t>(VERTEX_COUNT, [&](vertex_t u, vertex_t v) {
+                if (matrix[u][v]) {
+                    props_t props;
+                    if constexpr (std::is_floating_point_v<distance_t<props_t>>) {
+                        // not representable exactly, sums depend on the grouping
+                        props.weight = 0.1 * static_cast<double>(rng()() % 10);
+                    } else {
+                        props.weight = static_cast<std::int32_t>(rng()() % 10);
+                    }
+                    builder.withEdge(u, v, props);
+                }
+            });
+            DynamicGraph<vertex_t, props_t> graph = builder;
+
+            std::vector<distance_t<props_t>> expected;
+            std::vector<bool> on_path(VERTEX_COUNT, false);
+            allSimplePathLengths<props_t>(graph, 0, VERTEX_COUNT - 1, on_path, 0, expected);
+            std::sort(expected.begin(), expected.end());
+
+            KShortestPaths<vertex_t, props_t> paths(graph, 0, VERTEX_COUNT - 1);
+            std::set<std::vector<vertex_t>> seen;
+            for (auto length : expected) {
+                auto path = paths.next();
+                ASSERT_TRUE(path);
+                if constexpr (std::is_floating_point_v<distance_t<props_t>>) {
+                    ASSERT_NEAR(path->length, length, 1e-9);
+                } else {
+                    ASSERT_EQ(path->length, length);
+                }
+                ASSERT_EQ(path->vertices.front(), 0);
+                ASSERT_EQ(path->vertices.back(), VERTEX_COUNT - 1);
+                ASSERT_TRUE(seen.insert(path->vertices).second);
+                std::set<vertex_t> unique(path->vertices.begin(), path->vertices.end());
+                ASSERT_EQ(unique.size(), path->vertices.size());
+            }
+            ASSERT_FALSE(paths.next());
+        }
+    }
+}
+
+TEST(KShortestPaths, Simple) {
+    using props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+    DynamicGraph<test::vertex_t, props_t> graph = GraphBuilder<test::vertex_t, props_t>()
+            .withEdge(0, 1, test::weighted<props_t>(1))
+            .withEdge(1, 3, test::weighted<props_t>(1))
+            .withEdge(0, 2, test::weighted<props_t>(2))
+            .withEdge(2, 3, test::weighted<props_t>(2))
+            .withEdge(1, 2, test::weighted<props_t>(5));
+
+    auto paths = kShortestPaths<test::vertex_t, props_t>(graph, 0, 3, 3);
+    ASSERT_EQ(paths.size(), 3);
+    ASSERT_EQ(paths[0].vertices, (std::vector<test::vertex_t>{0, 1, 3}));
+    ASSERT_EQ(paths[0].length, 2);
+    ASSERT_EQ(paths[1].vertices, (std::vector<test::vertex_t>{0, 2, 3}));
+    ASSERT_EQ(paths[1].length, 4);
+    ASSERT_EQ(paths[2].length, 8);
+    ASSERT_EQ((kShortestPaths<test::vertex_t, props_t>(graph, 0, 3, 10).size()), 4);
+    ASSERT_TRUE((kShortestPaths<test::vertex_t, props_t>(graph, 0, 42, 10).empty()));
+}
+
+TEST(KShortestPaths, Undirected_Random) {
+    test::compareWithBruteForce<EdgeProps<Undirected, Weighted<std::int32_t>>>();
+}
+
+TEST(KShortestPaths, Directed_Random) {
+    test::compareWithBruteForce<EdgeProps<Directed, Weighted<std::int32_t>>>();
+}
+
+TEST(KShortestPaths, Floating_Random) {
+    test::compareWithBruteForce<EdgeProps<Undirected, Weighted<double>>>();
+}
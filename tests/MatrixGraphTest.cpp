@@ -0,0 +1,66 @@
+#include "TestsCommon.h"
+
+#include <ctpl/graph/MatrixGraph.h>
+
+namespace test {
+    template<typename props_t>
+    void matrixBuilding() {
+        detail::building<MatrixGraph<vertex_t, props_t>, props_t>();
+    };
+
+    template<typename props_t>
+    void matrixVisitAllEdgesRandom() {
+        detail::visitAllEdgesRandom<MatrixGraph<vertex_t, props_t>, props_t>();
+    }
+
+    template<typename props_t>
+    void matrixVisitAdjacentVerticesRandom() {
+        detail::visitAdjacentVerticesRandom<MatrixGraph<vertex_t, props_t>, props_t>();
+    }
+}
+
+TEST(MatrixGraph, BuildingUndirected) {
+    test::matrixBuilding<EdgeProps<Undirected>>();
+}
+
+TEST(MatrixGraph, BuildingDirected) {
+    test::matrixBuilding<EdgeProps<Directed>>();
+}
+
+TEST(MatrixGraph, VisitAllEdges_Undirected_Random) {
+    test::matrixVisitAllEdgesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(MatrixGraph, VisitAllEdges_Directed_Random) {
+    test::matrixVisitAllEdgesRandom<EdgeProps<Directed>>();
+}
+
+TEST(MatrixGraph, VisitAdjacentVertices_Undirected_Random) {
+    test::matrixVisitAdjacentVerticesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(MatrixGraph, VisitAdjacentVertices_Directed_Random) {
+    test::matrixVisitAdjacentVerticesRandom<EdgeProps<Directed>>();
+}
+
+TEST(MatrixGraph, AddRemoveWeighted) {
+    using props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+    props_t w;
+    w.weight = 3;
+
+    MatrixGraph<test::vertex_t, props_t> graph(130);
+    graph.addEdge(1, 129, w);
+    graph.addEdge(1, 64, w);
+    ASSERT_TRUE(graph.isEdgeBelongs(129, 1));
+    ASSERT_EQ(graph.getEdgeProps(1, 129)->weight, 3);
+    ASSERT_EQ(graph.degree(1), 2);
+
+    graph.removeEdge(129, 1);
+    ASSERT_FALSE(graph.isEdgeBelongs(1, 129));
+    ASSERT_FALSE(graph.getEdgeProps(1, 129).has_value());
+    ASSERT_EQ(graph.degree(1), 1);
+
+    ASSERT_THROW(graph.addEdge(1, 130, w), std::out_of_range);
+    ASSERT_THROW(graph.addEdge(-1, 1, w), std::out_of_range);
+    ASSERT_EQ(graph.degree(1), 1);
+}
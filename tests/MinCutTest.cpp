@@ -0,0 +1,82 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/MinCut.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/algo.h>
+
+namespace test {
+    template<typename props_t>
+    void checkCut(DynamicGraph<vertex_t, props_t> graph, const MinCut<vertex_t, props_t>& cut,
+                  vertex_t source, vertex_t target) {
+        auto edges = cut.cutEdges();
+        ASSERT_EQ(edges.size(), cut.value());
+        for (auto [u, v] : edges) {
+            ASSERT_TRUE(graph.isEdgeBelongs(u, v));
+            graph.removeEdge(u, v);
+        }
+        ASSERT_FALSE((shortestPathLength<vertex_t, props_t>(graph, source, target)));
+        ASSERT_TRUE(cut.isOnSourceSide(source));
+        ASSERT_FALSE(cut.isOnSourceSide(target));
+    }
+
+    template<typename props_t>
+    void incrementalRemovals() {
+        static constexpr std::size_t VERTEX_COUNT = 12;
+        int times = 20;
+        while (times--) {
+            auto matrix = generateRandomAdjacencyMatrix<props_t>(VERTEX_COUNT);
+            GraphBuilder<vertex_t, props_t> builder;
+            std::vector<std::pair<vertex_t, vertex_t>> edges;
+            iterateOverPossibleEdges<props_t>(VERTEX_COUNT, [&](vertex_t u, vertex_t v) {
+                if (matrix[u][v]) {
+                    builder.withEdge(u, v, {});
+                    edges.emplace_back(u, v);
+                }
+            });
+            DynamicGraph<vertex_t, props_t> graph = builder;
+            vertex_t source = 0;
+            vertex_t target = VERTEX_COUNT - 1;
+            MinCut<vertex_t, props_t> cut(graph, source, target);
+
+            std::shuffle(edges.begin(), edges.end(), rng());
+            for (auto [u, v] : edges) {
+                if (cut.value() > 0) {
+                    checkCut(graph, cut, source, target);
+                }
+                ASSERT_TRUE(cut.removeEdge(u, v));
+                ASSERT_FALSE(cut.removeEdge(u, v));
+                graph.removeEdge(u, v);
+                ASSERT_EQ(cut.value(), (MinCut<vertex_t, props_t>(graph, source, target).value()));
+            }
+            ASSERT_EQ(cut.value(), 0);
+        }
+    }
+}
+
+TEST(MinCut, Simple) {
+    using props_t = EdgeProps<Undirected>;
+    // two K4 joined by a pair of edges
+    DynamicGraph<test::vertex_t, props_t> graph = GraphBuilder<test::vertex_t, props_t>()
+            .withEdge(0, 1, {}).withEdge(1, 2, {}).withEdge(2, 0, {})
+            .withEdge(0, 6, {}).withEdge(1, 6, {}).withEdge(2, 6, {})
+            .withEdge(3, 4, {}).withEdge(4, 5, {}).withEdge(5, 3, {})
+            .withEdge(3, 7, {}).withEdge(4, 7, {}).withEdge(5, 7, {})
+            .withEdge(1, 3, {}).withEdge(2, 4, {});
+
+    MinCut<test::vertex_t, props_t> cut(graph, 0, 5);
+    ASSERT_EQ(cut.value(), 2);
+    ASSERT_EQ(cut.cutEdges(), (std::vector<std::pair<test::vertex_t, test::vertex_t>>{{1, 3}, {2, 4}}));
+
+    cut.removeEdge(1, 3);
+    ASSERT_EQ(cut.value(), 1);
+    ASSERT_EQ(cut.cutEdges(), (std::vector<std::pair<test::vertex_t, test::vertex_t>>{{2, 4}}));
+    ASSERT_TRUE(cut.isOnSourceSide(2));
+    ASSERT_FALSE(cut.isOnSourceSide(4));
+}
+
+TEST(MinCut, Undirected_Random) {
+    test::incrementalRemovals<EdgeProps<Undirected>>();
+}
+
+TEST(MinCut, Directed_Random) {
+    test::incrementalRemovals<EdgeProps<Directed>>();
+}
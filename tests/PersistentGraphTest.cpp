@@ -0,0 +1,114 @@
+#include "TestsCommon.h"
+
+#include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/PersistentGraph.h>
+#include <ctpl/graph/algo.h>
+
+namespace test {
+    template<typename props_t>
+    void persistentBuilding() {
+        detail::building<PersistentGraph<vertex_t, props_t>, props_t>();
+    };
+
+    template<typename props_t>
+    void persistentVisitAllEdgesRandom() {
+        detail::visitAllEdgesRandom<PersistentGraph<vertex_t, props_t>, props_t>();
+    }
+
+    template<typename props_t>
+    void persistentVisitAdjacentVerticesRandom() {
+        detail::visitAdjacentVerticesRandom<PersistentGraph<vertex_t, props_t>, props_t>();
+    }
+
+    using persistent_props_t = EdgeProps<Undirected, Weighted<int>>;
+}
+
+TEST(PersistentGraph, BuildingUndirected) {
+    test::persistentBuilding<EdgeProps<Undirected>>();
+}
+
+TEST(PersistentGraph, BuildingDirected) {
+    test::persistentBuilding<EdgeProps<Directed>>();
+}
+
+TEST(PersistentGraph, VisitAllEdges_Undirected_Random) {
+    test::persistentVisitAllEdgesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(PersistentGraph, VisitAllEdges_Directed_Random) {
+    test::persistentVisitAllEdgesRandom<EdgeProps<Directed>>();
+}
+
+TEST(PersistentGraph, VisitAdjacentVertices_Undirected_Random) {
+    test::persistentVisitAdjacentVerticesRandom<EdgeProps<Undirected>>();
+}
+
+TEST(PersistentGraph, VisitAdjacentVertices_Directed_Random) {
+    test::persistentVisitAdjacentVerticesRandom<EdgeProps<Directed>>();
+}
+
+TEST(PersistentGraph, SnapshotsAreIndependent) {
+    PersistentGraph<test::vertex_t, test::persistent_props_t> base =
+            GraphBuilder<test::vertex_t, test::persistent_props_t>()
+                    .withEdge(0, 1, test::weighted<test::persistent_props_t>(1))
+                    .withEdge(1, 3, test::weighted<test::persistent_props_t>(1))
+                    .withEdge(0, 2, test::weighted<test::persistent_props_t>(5))
+                    .withEdge(2, 3, test::weighted<test::persistent_props_t>(5));
+
+    auto banned = base.snapshot();
+    ASSERT_TRUE(banned.sharesStructureWith(base));
+    banned.removeEdge(3, 1);
+    banned.removeEdge(7, 8);
+    ASSERT_FALSE(banned.sharesStructureWith(base));
+
+    auto reweighted = base.snapshot();
+    reweighted.addEdge(0, 1, test::weighted<test::persistent_props_t>(20));
+
+    ASSERT_EQ(shortestPathLength(base, 0, 3), 2);
+    ASSERT_EQ(shortestPathLength(banned, 0, 3), 10);
+    ASSERT_EQ(shortestPathLength(reweighted, 0, 3), 10);
+    ASSERT_EQ(base.getEdgeProps(1, 0)->weight, 1);
+
+    auto untouched = base.snapshot();
+    untouched.removeEdge(5, 6);
+    ASSERT_TRUE(untouched.sharesStructureWith(base));
+}
+
+TEST(PersistentGraph, BranchesMatchDynamicGraph_Random) {
+    static constexpr std::size_t VERTEX_COUNT = 15;
+
+    for (int times = 0; times < 10; times++) {
+        std::vector<PersistentGraph<test::vertex_t, test::persistent_props_t>> versions(1);
+        std::vector<DynamicGraph<test::vertex_t, test::persistent_props_t>> expected(1, GraphBuilder<test::vertex_t, test::persistent_props_t>());
+        for (int step = 0; step < 300; step++) {
+            std::size_t from = test::rng()() % versions.size();
+            auto version = versions[from].snapshot();
+            auto copy = expected[from];
+            test::vertex_t u = test::rng()() % VERTEX_COUNT;
+            test::vertex_t v = test::rng()() % VERTEX_COUNT;
+            if (test::rng()() % 3) {
+                auto w = test::weighted<test::persistent_props_t>(1 + test::rng()() % 10);
+                version.addEdge(u, v, w);
+                copy.addEdge(u, v, w);
+            } else {
+                version.removeEdge(u, v);
+                copy.removeEdge(u, v);
+            }
+            versions.push_back(std::move(version));
+            expected.push_back(std::move(copy));
+        }
+
+        for (std::size_t i = 0; i < versions.size(); i++) {
+            for (test::vertex_t u = 0; u < VERTEX_COUNT; u++) {
+                for (test::vertex_t v = 0; v < VERTEX_COUNT; v++) {
+                    auto actual_props = versions[i].getEdgeProps(u, v);
+                    auto expected_props = expected[i].getEdgeProps(u, v);
+                    ASSERT_EQ(actual_props.has_value(), expected_props.has_value());
+                    if (actual_props) {
+                        ASSERT_EQ(actual_props->weight, expected_props->weight);
+                    }
+                }
+            }
+        }
+    }
+}
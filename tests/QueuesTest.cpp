@@ -0,0 +1,85 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/algo.h>
+#include <ctpl/graph/queues.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <set>
+
+namespace test {
+    template<template<typename, typename> class Queue>
+    void monotoneRandom() {
+        Queue<std::int32_t, int> queue;
+        std::multiset<std::int32_t> expected;
+        std::int32_t last = 0;
+
+        int times = 10000;
+        while (times--) {
+            if (expected.empty() || rng()() % 3 != 0) {
+                auto key = last + static_cast<std::int32_t>(rng()() % 100);
+                queue.push(key, key);
+                expected.insert(key);
+            } else {
+                auto [key, value] = queue.pop();
+                ASSERT_EQ(key, *expected.begin());
+                ASSERT_EQ(key, value);
+                expected.erase(expected.begin());
+                last = key;
+            }
+        }
+        while (!expected.empty()) {
+            ASSERT_FALSE(queue.empty());
+            ASSERT_EQ(queue.pop().first, *expected.begin());
+            expected.erase(expected.begin());
+        }
+        ASSERT_TRUE(queue.empty());
+    }
+
+    template<template<typename, typename> class Queue>
+    void dijkstraWithQueue() {
+        using props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+        static constexpr std::size_t VERTEX_COUNT = 20;
+
+        auto matrix = generateRandomAdjacencyMatrix<props_t>(VERTEX_COUNT);
+        GraphBuilder<vertex_t, props_t> builder;
+        iterateOverPossibleEdges<props_t>(VERTEX_COUNT, [&](vertex_t u, vertex_t v) {
+            if (matrix[u][v]) {
+                props_t props;
+                props.weight = static_cast<std::int32_t>(rng()() % 50);
+                builder.withEdge(u, v, props);
+            }
+        });
+        DynamicGraph<vertex_t, props_t> graph = builder;
+
+        std::unordered_map<vertex_t, std::int32_t> dist;
+        dijkstraCustom<Queue>(graph, 0,
+                              [&](vertex_t u) { return dist.contains(u); },
+                              [](vertex_t, vertex_t) {},
+                              [&](vertex_t v, std::int32_t d) { dist[v] = d; });
+        for (vertex_t v = 0; v < VERTEX_COUNT; v++) {
+            auto expected = dijkstra(graph, 0, v);
+            ASSERT_EQ(expected.has_value(), dist.contains(v));
+            if (expected) {
+                ASSERT_EQ(*expected, dist[v]);
+            }
+        }
+    }
+}
+
+TEST(Queues, Dial_MonotoneRandom) {
+    test::monotoneRandom<DialQueue>();
+}
+
+TEST(Queues, RadixHeap_MonotoneRandom) {
+    test::monotoneRandom<RadixHeapQueue>();
+}
+
+TEST(Queues, BinaryHeap_MonotoneRandom) {
+    test::monotoneRandom<BinaryHeapQueue>();
+}
+
+TEST(Queues, Dijkstra_Dial) {
+    test::dijkstraWithQueue<DialQueue>();
+}
+
+TEST(Queues, Dijkstra_RadixHeap) {
+    test::dijkstraWithQueue<RadixHeapQueue>();
+}
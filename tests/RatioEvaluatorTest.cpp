@@ -0,0 +1,118 @@
+#include "GameTestsCommon.h"
+#include <ctpl/game/RatioEvaluator.h>
+#include <ctpl/game/Round.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <cmath>
+
+using namespace ctpl::game;
+
+namespace test {
+    using ratio_props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+
+    // two routes from 0 to 3: 0-1-3 of length 2 and 0-2-3 of length 10
+    inline GraphBuilder<vertex_t, ratio_props_t> twoRoutesGraph() {
+        GraphBuilder<vertex_t, ratio_props_t> builder;
+        builder.withEdge(0, 1, weighted<ratio_props_t>(1))
+                .withEdge(1, 3, weighted<ratio_props_t>(1))
+                .withEdge(0, 2, weighted<ratio_props_t>(5))
+                .withEdge(2, 3, weighted<ratio_props_t>(5));
+        return builder;
+    }
+
+    class BanOnceAdversary : public IAdversary<vertex_t> {
+    public:
+        BanOnceAdversary(IBanValidator<vertex_t>& validator, vertex_t at, std::pair<vertex_t, vertex_t> edge)
+                : IAdversary<vertex_t>(validator), at_(at), edge_(edge) {
+        }
+
+        void notifyTravellerStep(vertex_t u, vertex_t v) override {
+            if (v == at_) {
+                tryBanEdge(edge_.first, edge_.second);
+            }
+        }
+
+    private:
+        vertex_t at_;
+        std::pair<vertex_t, vertex_t> edge_;
+    };
+}
+
+TEST(RatioEvaluator, NoBans) {
+    DynamicGraph<test::vertex_t, test::ratio_props_t> graph = test::twoRoutesGraph();
+    auto res = evaluateRound(graph, RoundRecord<test::vertex_t>{{0, 1, 3}, {}});
+    ASSERT_EQ(res.walked, 2);
+    ASSERT_EQ(res.offline_optimum, 2);
+    ASSERT_DOUBLE_EQ(res.ratio, 1.0);
+}
+
+TEST(RatioEvaluator, BansChangeOptimum) {
+    DynamicGraph<test::vertex_t, test::ratio_props_t> graph = test::twoRoutesGraph();
+    auto res = evaluateRound(graph, RoundRecord<test::vertex_t>{{0, 1, 0, 2, 3}, {{3, 1}}});
+    ASSERT_EQ(res.walked, 12);
+    ASSERT_EQ(res.offline_optimum, 10);
+    ASSERT_DOUBLE_EQ(res.ratio, 1.2);
+    ASSERT_TRUE(graph.isEdgeBelongs(1, 3));
+
+    auto disconnected = evaluateRound(graph, RoundRecord<test::vertex_t>{{0, 1, 3}, {{1, 3}, {0, 2}}});
+    ASSERT_FALSE(disconnected.offline_optimum.has_value());
+    ASSERT_TRUE(std::isnan(disconnected.ratio));
+}
+
+TEST(RatioEvaluator, InvalidPath) {
+    DynamicGraph<test::vertex_t, test::ratio_props_t> graph = test::twoRoutesGraph();
+    ASSERT_THROW(evaluateRound(graph, RoundRecord<test::vertex_t>{{0, 3}, {}}), RoundEvaluationException);
+    ASSERT_THROW(evaluateRound(graph, RoundRecord<test::vertex_t>{}), RoundEvaluationException);
+}
+
+TEST(RatioEvaluator, PlayedRound) {
+    DynamicGraph<test::vertex_t, test::ratio_props_t> original = test::twoRoutesGraph();
+    DynamicGraph<test::vertex_t, test::ratio_props_t> graph = original;
+    test::GreedyTraveller<test::ratio_props_t> traveller(graph, 3);
+    test::KBanValidator<test::ratio_props_t> ban_validator(traveller, graph, 1);
+    test::EdgeStepValidator<test::ratio_props_t> step_validator(graph);
+    test::BanOnceAdversary adversary(ban_validator, 1, {1, 3});
+
+    RoundRecord<test::vertex_t> record;
+    record.path = Round<test::vertex_t>(0, 3, traveller, adversary, ban_validator, step_validator).run();
+    record.bans = ban_validator.bannedEdges();
+    ASSERT_EQ(record.path, (std::vector<test::vertex_t>{0, 1, 0, 2, 3}));
+    ASSERT_EQ(ban_validator.banLog().size(), 1);
+    ASSERT_EQ(record.bans.size(), 1);
+
+    auto res = evaluateRound(original, record);
+    ASSERT_EQ(res.walked, 12);
+    ASSERT_EQ(res.offline_optimum, 10);
+}
+
+TEST(RatioEvaluator, Parallel) {
+    DynamicGraph<test::vertex_t, test::ratio_props_t> graph = test::twoRoutesGraph();
+    std::vector<RoundRecord<test::vertex_t>> rounds;
+    for (int i = 0; i < 100; i++) {
+        if (i % 2) {
+            rounds.push_back({{0, 1, 3}, {}});
+        } else {
+            rounds.push_back({{0, 1, 0, 2, 3}, {{1, 3}}});
+        }
+    }
+    std::vector<EvaluationTask<test::vertex_t, test::ratio_props_t>> tasks;
+    for (const auto& round : rounds) {
+        tasks.push_back({&graph, &round});
+    }
+
+    auto evaluations = evaluateRounds<test::vertex_t, test::ratio_props_t>(tasks, 4);
+    ASSERT_EQ(evaluations.size(), rounds.size());
+    for (std::size_t i = 0; i < rounds.size(); i++) {
+        ASSERT_DOUBLE_EQ(evaluations[i].ratio, i % 2 ? 1.0 : 1.2);
+    }
+
+    auto summary = summarize<std::int32_t>(evaluations);
+    ASSERT_EQ(summary.rounds, 100);
+    ASSERT_EQ(summary.undefined, 0);
+    ASSERT_DOUBLE_EQ(summary.mean, 1.1);
+    ASSERT_DOUBLE_EQ(summary.min, 1.0);
+    ASSERT_DOUBLE_EQ(summary.max, 1.2);
+    ASSERT_NEAR(summary.geometric_mean, std::sqrt(1.2), 1e-9);
+
+    rounds[7].path = {0, 3};
+    ASSERT_THROW((evaluateRounds<test::vertex_t, test::ratio_props_t>(tasks, 4)), RoundEvaluationException);
+}
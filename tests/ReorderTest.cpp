@@ -0,0 +1,132 @@
+#include "TestsCommon.h"
+#include <ctpl/game/outerplanar/DividedGenerator.h>
+#include <ctpl/game/outerplanar/DividedGraph.h>
+#include <ctpl/graph/Reorder.h>
+#include <ctpl/graph/IndexedGraph.h>
+#include <ctpl/graph/algo.h>
+
+namespace test {
+    using weighted_props_t = EdgeProps<Directed, Weighted<std::int32_t>>;
+
+    // w x w grid with randomly shuffled ids
+    GraphBuilder<vertex_t, EdgeProps<Undirected>> shuffledGrid(vertex_t w) {
+        std::vector<vertex_t> id(w * w);
+        std::iota(id.begin(), id.end(), 0);
+        std::shuffle(id.begin(), id.end(), rng());
+        GraphBuilder<vertex_t, EdgeProps<Undirected>> builder;
+        for (vertex_t i = 0; i < w; i++) {
+            for (vertex_t j = 0; j < w; j++) {
+                if (i + 1 < w) {
+                    builder.withEdge(id[i * w + j], id[(i + 1) * w + j], {});
+                }
+                if (j + 1 < w) {
+                    builder.withEdge(id[i * w + j], id[i * w + j + 1], {});
+                }
+            }
+        }
+        return builder;
+    }
+
+    template<typename builder_t>
+    std::size_t bandwidth(const builder_t& builder) {
+        std::size_t res = 0;
+        for (const auto& e : builder.edges()) {
+            res = std::max<std::size_t>(res, e.u > e.v ? e.u - e.v : e.v - e.u);
+        }
+        return res;
+    }
+}
+
+TEST(Reorder, Permutation) {
+    Permutation<test::vertex_t> permutation({2, 0, 3, 1});
+    ASSERT_EQ(permutation.size(), 4);
+    ASSERT_EQ(permutation.toNew(2), 0);
+    ASSERT_EQ(permutation.toOld(0), 2);
+    ASSERT_EQ(permutation.toNew(1), 3);
+    std::vector<test::vertex_t> path = {0, 1, 2};
+    ASSERT_EQ(permutation.toOld(permutation.toNew(path)), path);
+    ASSERT_EQ(Permutation<test::vertex_t>::identity(3).order(), (std::vector<test::vertex_t>{0, 1, 2}));
+}
+
+TEST(Reorder, OrdersAreBijections) {
+    // isolated vertices and several components
+    auto builder = test::shuffledGrid(5).withEdge(30, 31, {}).withVertexCount(33);
+    for (auto kind : {VertexOrder::IDENTITY, VertexOrder::BFS, VertexOrder::REVERSE_CUTHILL_MCKEE,
+                      VertexOrder::NESTED_DISSECTION}) {
+        auto permutation = vertexOrder(builder, kind);
+        ASSERT_EQ(permutation.size(), 33);
+        std::vector<test::vertex_t> sorted = permutation.order();
+        std::sort(sorted.begin(), sorted.end());
+        ASSERT_EQ(sorted, Permutation<test::vertex_t>::identity(33).order());
+    }
+}
+
+TEST(Reorder, ReverseCuthillMcKeeBandwidth) {
+    static constexpr test::vertex_t W = 30;
+    auto builder = test::shuffledGrid(W);
+    auto bfs = reordered(builder, vertexOrder(builder, VertexOrder::BFS));
+    auto rcm = reordered(builder, vertexOrder(builder, VertexOrder::REVERSE_CUTHILL_MCKEE));
+    ASSERT_GT(test::bandwidth(builder), 4 * W);
+    // level structure of a grid from a corner is the anti-diagonals
+    ASSERT_LE(test::bandwidth(bfs), 2 * W);
+    ASSERT_LE(test::bandwidth(rcm), 2 * W);
+}
+
+TEST(Reorder, ShortestPathsArePreserved) {
+    static constexpr std::size_t VERTEX_COUNT = 40;
+    auto matrix = test::generateRandomAdjacencyMatrix<test::weighted_props_t>(VERTEX_COUNT);
+    GraphBuilder<test::vertex_t, test::weighted_props_t> builder;
+    test::iterateOverPossibleEdges<test::weighted_props_t>(VERTEX_COUNT, [&](test::vertex_t u, test::vertex_t v) {
+        if (matrix[u][v]) {
+            test::weighted_props_t props;
+            props.weight = static_cast<std::int32_t>(test::rng()() % 100);
+            builder.withEdge(u, v, props);
+        }
+    });
+    IndexedGraph<test::vertex_t, test::weighted_props_t> graph = builder;
+
+    for (auto kind : {VertexOrder::BFS, VertexOrder::REVERSE_CUTHILL_MCKEE}) {
+        auto permutation = vertexOrder(builder, kind);
+        IndexedGraph<test::vertex_t, test::weighted_props_t> reordered_graph = reordered(builder, permutation);
+        for (test::vertex_t s = 0; s < VERTEX_COUNT; s += 3) {
+            for (test::vertex_t t = 0; t < VERTEX_COUNT; t++) {
+                auto expected = shortestPathLength(graph, s, t);
+                ASSERT_EQ(expected, shortestPathLength(reordered_graph, permutation.toNew(s), permutation.toNew(t)));
+                auto path = permutation.toOld(shortestPath(reordered_graph, permutation.toNew(s), permutation.toNew(t)));
+                ASSERT_EQ(expected.has_value(), !path.empty());
+                if (!path.empty()) {
+                    ASSERT_EQ(path.front(), s);
+                    ASSERT_EQ(path.back(), t);
+                    std::int32_t length = 0;
+                    for (std::size_t i = 0; i + 1 < path.size(); i++) {
+                        length += graph.getEdgeProps(path[i], path[i + 1])->weight;
+                    }
+                    ASSERT_EQ(length, *expected);
+                }
+            }
+        }
+    }
+}
+
+TEST(Reorder, OuterFaceOrder) {
+    using namespace ctpl::game;
+    auto builder = generateDividedOuterplanar({.vertex_count = 200, .chord_density = 0.7, .seed = 3});
+    auto permutation = outerFaceOrder(builder);
+    auto divided = reordered(builder, permutation);
+
+    // side A is 0, 1, ..., side B continues backwards from the target
+    std::vector<default_vertex_t> side_a = divided.sideA();
+    ASSERT_EQ(side_a, Permutation<default_vertex_t>::identity(side_a.size()).order());
+    const auto& side_b = divided.sideB();
+    ASSERT_EQ(side_b.front(), 0);
+    for (std::size_t i = 1; i + 1 < side_b.size(); i++) {
+        ASSERT_EQ(side_b[i], 200 - i);
+    }
+
+    // validated again, not just trusted
+    divided.withTrusted(false);
+    DividedOuterplanarGraph graph(builder);
+    DividedOuterplanarGraph reordered_graph(divided);
+    ASSERT_EQ(shortestPathLength(graph, builder.sideA().front(), builder.sideB().back()),
+              shortestPathLength(reordered_graph, divided.sideA().front(), divided.sideB().back()));
+}
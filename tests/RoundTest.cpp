@@ -0,0 +1,150 @@
+#include "GameTestsCommon.h"
+#include <ctpl/game/Round.h>
+#include <ctpl/graph/DynamicGraph.h>
+
+using namespace ctpl::game;
+
+namespace test {
+    using round_props_t = EdgeProps<Undirected>;
+    using Event = RoundEvent<vertex_t>;
+
+    class StuckTraveller : public ITraveller<vertex_t> {
+    public:
+        vertex_t makeStep(vertex_t current_vertex) override {
+            return current_vertex + 100;
+        }
+    };
+
+    class BatchCountingTraveller : public ITraveller<vertex_t> {
+    public:
+        vertex_t makeStep(vertex_t current_vertex) override {
+            return current_vertex + 1;
+        }
+
+        void notifyBannedBatch(std::span<const std::pair<vertex_t, vertex_t>> edges) override {
+            batches.emplace_back(edges.begin(), edges.end());
+        }
+
+        std::vector<std::vector<std::pair<vertex_t, vertex_t>>> batches;
+    };
+
+    class BanBehindAdversary : public IAdversary<vertex_t> {
+    public:
+        using IAdversary<vertex_t>::IAdversary;
+
+        void notifyTravellerStep(vertex_t u, vertex_t v) override {
+            tryBanEdge(u, v);
+        }
+    };
+
+    // path 0 - 1 - ... - n-1
+    inline GraphBuilder<vertex_t, round_props_t> pathGraph(vertex_t n) {
+        GraphBuilder<vertex_t, round_props_t> builder;
+        for (vertex_t u = 0; u + 1 < n; u++) {
+            builder.withEdge(u, u + 1, {});
+        }
+        return builder;
+    }
+
+    struct PathRound {
+        explicit PathRound(vertex_t n) : graph(pathGraph(n)), traveller(graph, n - 1), ban_validator(traveller, graph, 1),
+                                         step_validator(graph), adversary(ban_validator),
+                                         round(0, n - 1, traveller, adversary, ban_validator, step_validator) {
+        }
+
+        DynamicGraph<vertex_t, round_props_t> graph;
+        GreedyTraveller<round_props_t> traveller;
+        KBanValidator<round_props_t> ban_validator;
+        EdgeStepValidator<round_props_t> step_validator;
+        BanBehindAdversary adversary;
+        Round<vertex_t> round;
+    };
+}
+
+TEST(Round, Events) {
+    test::PathRound path_round(3);
+    std::vector<test::Event::Type> types;
+    std::vector<std::pair<test::vertex_t, test::vertex_t>> edges;
+    for (const auto& event : path_round.round.events()) {
+        types.push_back(event.type);
+        edges.push_back({event.u, event.v});
+    }
+
+    using Type = test::Event::Type;
+    ASSERT_EQ(types, (std::vector<Type>{Type::STEP, Type::BAN, Type::STEP, Type::FINISHED}));
+    ASSERT_EQ(edges, (std::vector<std::pair<test::vertex_t, test::vertex_t>>{{0, 1}, {0, 1}, {1, 2}, {2, 2}}));
+}
+
+TEST(Round, StepLimit) {
+    DynamicGraph<test::vertex_t, test::round_props_t> graph = test::pathGraph(3);
+    test::StuckTraveller traveller;
+    test::KBanValidator<test::round_props_t> ban_validator(traveller, graph, 0);
+    test::EdgeStepValidator<test::round_props_t> step_validator(graph);
+    test::BanBehindAdversary adversary(ban_validator);
+    Round<test::vertex_t> round(0, 2, traveller, adversary, ban_validator, step_validator);
+
+    auto events = round.events(5);
+    std::size_t rejected = 0;
+    while (events.next()) {
+        if (events.value().type == test::Event::Type::REJECTED_STEP) {
+            ++rejected;
+        } else {
+            ASSERT_EQ(events.value().type, test::Event::Type::STEP_LIMIT);
+        }
+    }
+    ASSERT_EQ(rejected, 5);
+    ASSERT_THROW(round.run(10), RoundStepLimitException);
+}
+
+TEST(Round, Interleaved) {
+    static constexpr std::size_t ROUND_COUNT = 1000;
+
+    std::vector<std::unique_ptr<test::PathRound>> rounds;
+    std::vector<Generator<test::Event>> streams;
+    for (std::size_t i = 0; i < ROUND_COUNT; i++) {
+        rounds.push_back(std::make_unique<test::PathRound>(2 + i % 5));
+        streams.push_back(rounds.back()->round.events());
+    }
+
+    // one event of every round per pass
+    std::size_t active = ROUND_COUNT;
+    std::vector<std::size_t> steps(ROUND_COUNT, 0);
+    while (active > 0) {
+        active = 0;
+        for (std::size_t i = 0; i < ROUND_COUNT; i++) {
+            if (!streams[i].next()) {
+                continue;
+            }
+            ++active;
+            steps[i] += streams[i].value().type == test::Event::Type::STEP;
+        }
+    }
+    for (std::size_t i = 0; i < ROUND_COUNT; i++) {
+        ASSERT_EQ(steps[i], 1 + i % 5);
+    }
+}
+
+TEST(Round, BatchBans) {
+    using Edges = std::vector<std::pair<test::vertex_t, test::vertex_t>>;
+    DynamicGraph<test::vertex_t, test::round_props_t> graph = test::pathGraph(5);
+    test::BatchCountingTraveller traveller;
+    test::KBanValidator<test::round_props_t> ban_validator(traveller, graph, 2);
+
+    // repeated edge and exhausted budget are rejected within the batch
+    Edges bans = {{0, 1}, {1, 0}, {1, 2}, {2, 3}};
+    ASSERT_EQ(ban_validator.requestBanEdges(bans), (std::vector<bool>{true, false, true, false}));
+    ASSERT_EQ(traveller.batches, (std::vector<Edges>{{{0, 1}, {1, 2}}}));
+    ASSERT_FALSE(graph.isEdgeBelongs(0, 1));
+    ASSERT_FALSE(graph.isEdgeBelongs(2, 1));
+    ASSERT_TRUE(graph.isEdgeBelongs(2, 3));
+
+    const auto& log = ban_validator.banLog();
+    ASSERT_EQ(log.size(), 4);
+    ASSERT_TRUE(log[0].accepted);
+    ASSERT_FALSE(log[1].accepted);
+    ASSERT_EQ(log[3].u, 2);
+
+    // nothing accepted, nothing to notify
+    ASSERT_EQ(ban_validator.requestBanEdges(Edges{{3, 4}}), std::vector<bool>{false});
+    ASSERT_EQ(traveller.batches.size(), 1);
+}
@@ -0,0 +1,128 @@
+#include "GameTestsCommon.h"
+#include <ctpl/game/Round.h>
+#include <ctpl/game/RoundReplay.h>
+#include <ctpl/graph/DynamicGraph.h>
+
+using namespace ctpl::game;
+
+namespace {
+    using props_t = EdgeProps<Undirected>;
+    using Record = TraceRecord<test::vertex_t>;
+
+    // bans the edge just walked and the next edge of the path
+    class BanAroundAdversary : public IAdversary<test::vertex_t> {
+    public:
+        using IAdversary<test::vertex_t>::IAdversary;
+
+        void notifyTravellerStep(test::vertex_t u, test::vertex_t v) override {
+            tryBanEdge(u, v);
+            tryBanEdge(v, v + 1);
+        }
+    };
+
+    // 0 - 1 - ... - n-1 with shortcuts i - (i + 2)
+    DynamicGraph<test::vertex_t, props_t> ladderGraph(test::vertex_t n) {
+        GraphBuilder<test::vertex_t, props_t> builder;
+        for (test::vertex_t u = 0; u + 1 < n; u++) {
+            builder.withEdge(u, u + 1, {});
+            if (u + 2 < n) {
+                builder.withEdge(u, u + 2, {});
+            }
+        }
+        return builder;
+    }
+
+    RoundTrace<test::vertex_t> recordLadderRound(test::vertex_t n, std::size_t k) {
+        auto graph = ladderGraph(n);
+        test::GreedyTraveller<props_t> traveller(graph, n - 1);
+        test::KBanValidator<props_t> ban_validator(traveller, graph, k);
+        test::EdgeStepValidator<props_t> step_validator(graph);
+        BanAroundAdversary adversary(ban_validator);
+        Round<test::vertex_t> round(0, n - 1, traveller, adversary, ban_validator, step_validator);
+        return round.record(42, 7);
+    }
+}
+
+TEST(RoundTrace, Record) {
+    auto trace = recordLadderRound(5, 1);
+    ASSERT_EQ(trace.graph_id, 42);
+    ASSERT_EQ(trace.seed, 7);
+    using Type = Record::Type;
+    ASSERT_EQ(trace.records, (std::vector<Record>{
+            {Type::STEP, 0, 2},
+            {Type::BAN, 0, 2},
+            {Type::REJECTED_BAN, 2, 3},
+            {Type::STEP, 2, 4},
+            {Type::REJECTED_BAN, 2, 4},
+            {Type::REJECTED_BAN, 4, 5},
+            {Type::FINISHED, 4, 4}
+    }));
+}
+
+TEST(RoundTrace, EncodeDecode) {
+    auto trace = recordLadderRound(50, 10);
+    auto data = trace.encode();
+    ASSERT_EQ(RoundTrace<test::vertex_t>::decode(data), trace);
+    // a type byte and at most two one byte vertices per record
+    ASSERT_LE(data.size(), 32 + 3 * trace.records.size());
+
+    ASSERT_THROW(RoundTrace<test::vertex_t>::decode(data.substr(0, data.size() - 1)), TraceFormatException);
+    ASSERT_THROW(RoundTrace<test::vertex_t>::decode(data + "x"), TraceFormatException);
+    ASSERT_THROW(RoundTrace<test::vertex_t>::decode("trace"), TraceFormatException);
+}
+
+TEST(RoundTrace, NegativeVertices) {
+    using Type = TraceRecord<std::int64_t>::Type;
+    RoundTrace<std::int64_t> trace{1, 2, -5, 1LL << 40};
+    trace.records = {
+            {Type::REJECTED_STEP, -5, -1},
+            {Type::STEP, -5, 1LL << 40},
+            {Type::BAN, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()},
+            {Type::FINISHED, 1LL << 40, 1LL << 40}
+    };
+    ASSERT_EQ(RoundTrace<std::int64_t>::decode(trace.encode()), trace);
+}
+
+TEST(RoundTrace, VertexOutOfRange) {
+    using Type = TraceRecord<std::int64_t>::Type;
+    RoundTrace<std::int64_t> trace{1, 2, 0, 1};
+    trace.records = {{Type::BAN, 0, std::numeric_limits<std::int32_t>::max()}, {Type::FINISHED, 0, 0}};
+    ASSERT_EQ(RoundTrace<std::int32_t>::decode(trace.encode()).records[0].v, std::numeric_limits<std::int32_t>::max());
+
+    trace.records[0].v = std::numeric_limits<std::int32_t>::max() + 1LL;
+    ASSERT_THROW(RoundTrace<std::int32_t>::decode(trace.encode()), TraceFormatException);
+    trace.records[0].v = std::numeric_limits<std::int32_t>::min() - 1LL;
+    ASSERT_THROW(RoundTrace<std::int32_t>::decode(trace.encode()), TraceFormatException);
+
+    RoundTrace<std::uint64_t> wide{1, 2, 0, 1ULL << 32};
+    ASSERT_THROW(RoundTrace<std::uint32_t>::decode(wide.encode()), TraceFormatException);
+}
+
+TEST(RoundTrace, Replay) {
+    static constexpr test::vertex_t N = 30;
+    auto trace = recordLadderRound(N, 5);
+
+    auto graph = ladderGraph(N);
+    RoundReplay<test::vertex_t> replay(RoundTrace<test::vertex_t>::decode(trace.encode()));
+    test::KBanValidator<props_t> ban_validator(replay.traveller(), graph, 5);
+    test::EdgeStepValidator<props_t> step_validator(graph);
+    auto result = replay.run(ban_validator, step_validator);
+    ASSERT_TRUE(result.matches());
+    ASSERT_EQ(result.trace, trace);
+}
+
+TEST(RoundTrace, ReplayDetectsDivergence) {
+    static constexpr test::vertex_t N = 30;
+    auto trace = recordLadderRound(N, 5);
+
+    // fewer bans are allowed, so some recorded bans are rejected now
+    auto graph = ladderGraph(N);
+    RoundReplay<test::vertex_t> replay(trace);
+    test::KBanValidator<props_t> ban_validator(replay.traveller(), graph, 2);
+    test::EdgeStepValidator<props_t> step_validator(graph);
+    auto result = replay.run(ban_validator, step_validator);
+    ASSERT_FALSE(result.matches());
+    std::size_t mismatch = *result.first_mismatch;
+    ASSERT_EQ(result.trace.records[mismatch].type, Record::Type::REJECTED_BAN);
+    ASSERT_EQ(trace.records[mismatch].type, Record::Type::BAN);
+}
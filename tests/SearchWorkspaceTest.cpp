@@ -0,0 +1,116 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/algo.h>
+#include <ctpl/graph/DynamicGraph.h>
+#include <unordered_set>
+
+namespace test {
+    template<typename props_t>
+    GraphBuilder<vertex_t, props_t> randomBuilder(std::size_t vertex_count, std::int32_t max_weight) {
+        auto matrix = generateRandomAdjacencyMatrix<props_t>(vertex_count);
+        GraphBuilder<vertex_t, props_t> builder;
+        iterateOverPossibleEdges<props_t>(vertex_count, [&](vertex_t u, vertex_t v) {
+            if (matrix[u][v]) {
+                props_t props;
+                if constexpr (IsPropsWeighted<props_t>::value) {
+                    props.weight = static_cast<std::int32_t>(rng()() % (max_weight + 1));
+                }
+                builder.withEdge(u, v, props);
+            }
+        });
+        return builder;
+    }
+
+    template<typename props_t>
+    void compareWithFreshSearch(std::int32_t max_weight) {
+        static constexpr std::size_t VERTEX_COUNT = 20;
+
+        // one workspace for all graphs and queries
+        SearchWorkspace<vertex_t, props_t> workspace;
+        std::vector<vertex_t> path;
+        int times = 10;
+        while (times--) {
+            DynamicGraph<vertex_t, props_t> graph = randomBuilder<props_t>(VERTEX_COUNT, max_weight);
+            for (vertex_t s = 0; s < VERTEX_COUNT; s += 7) {
+                auto expected = distances(graph, s);
+                distances(graph, s, workspace);
+                for (vertex_t v = 0; v < VERTEX_COUNT; v++) {
+                    ASSERT_EQ(expected.contains(v), workspace.isReached(v));
+                    if (expected.contains(v)) {
+                        ASSERT_EQ(expected[v], workspace.distance(v));
+                    }
+                }
+                for (vertex_t v = 0; v < VERTEX_COUNT; v++) {
+                    ASSERT_EQ((shortestPathLength(graph, s, v)), (shortestPathLength(graph, s, v, workspace)));
+                    ASSERT_EQ(expected.contains(v), (shortestPath(graph, s, v, workspace, path)));
+                    if (!path.empty()) {
+                        ASSERT_EQ(path.front(), s);
+                        ASSERT_EQ(path.back(), v);
+                        distance_t<props_t> length = 0;
+                        for (std::size_t i = 0; i + 1 < path.size(); i++) {
+                            length += edgeLength(*graph.getEdgeProps(path[i], path[i + 1]));
+                        }
+                        ASSERT_EQ(length, expected[v]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(SearchWorkspace, Unweighted_Random) {
+    test::compareWithFreshSearch<EdgeProps<Undirected>>(0);
+}
+
+TEST(SearchWorkspace, ZeroOne_Random) {
+    test::compareWithFreshSearch<EdgeProps<Undirected, Weighted<std::int32_t>, MaxWeight<1>>>(1);
+}
+
+TEST(SearchWorkspace, Dial_Random) {
+    test::compareWithFreshSearch<EdgeProps<Directed, Weighted<std::int32_t>, MaxWeight<10>>>(10);
+}
+
+TEST(SearchWorkspace, RadixHeap_Random) {
+    test::compareWithFreshSearch<EdgeProps<Undirected, Weighted<std::int32_t>>>(1000);
+}
+
+TEST(SearchWorkspace, BinaryHeap_Random) {
+    test::compareWithFreshSearch<EdgeProps<Directed, Weighted<double>>>(1000);
+}
+
+TEST(SearchWorkspace, CustomTraversals) {
+    using props_t = EdgeProps<Undirected, Weighted<std::int32_t>, MaxWeight<1>>;
+    SearchWorkspace<test::vertex_t, props_t> workspace;
+    int times = 10;
+    while (times--) {
+        DynamicGraph<test::vertex_t, props_t> graph = test::randomBuilder<props_t>(20, 1);
+        for (bool depth_first : {false, true}) {
+            std::vector<test::vertex_t> expected;
+            std::vector<test::vertex_t> order;
+            std::unordered_set<test::vertex_t> used;
+            auto visit = [&](test::vertex_t v) { expected.push_back(v); };
+            auto is_visited = [&](test::vertex_t v) { return used.contains(v); };
+            auto set_visited = [&](test::vertex_t, test::vertex_t v) { used.insert(v); };
+            if (depth_first) {
+                dfsCustom(graph, 0, visit, is_visited, set_visited);
+                dfsCustom(graph, 0, [&](test::vertex_t v) { order.push_back(v); }, workspace);
+            } else {
+                bfsCustom(graph, 0, visit, is_visited, set_visited);
+                bfsCustom(graph, 0, [&](test::vertex_t v) { order.push_back(v); }, workspace);
+            }
+            ASSERT_EQ(order, expected);
+            for (auto v : order) {
+                ASSERT_TRUE(v == 0 || workspace.isReached(workspace.parent(v)));
+            }
+        }
+
+        auto expected = distances(graph, 0);
+        std::unordered_map<test::vertex_t, std::int32_t> dist;
+        std::unordered_map<test::vertex_t, test::vertex_t> parents;
+        zeroOneBfsCustom(graph, 0, [&](test::vertex_t u, test::vertex_t v) { parents[v] = u; },
+                         [&](test::vertex_t v, std::int32_t d) { dist[v] = d; }, workspace);
+        ASSERT_EQ(dist, expected);
+        for (const auto& [v, u] : parents) {
+            ASSERT_EQ(u, workspace.parent(v));
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#include "TestsCommon.h"
+#include <ctpl/graph/DynamicGraph.h>
+#include <ctpl/graph/algo.h>
+#include <ctpl/util/parallel.h>
+#include <ctpl/util/stats.h>
+
+namespace test {
+    using stats_props_t = EdgeProps<Undirected, Weighted<double>>;
+
+    // 0 - 1 - 2 with a long shortcut 0 - 2, so Dijkstra pops vertex 2 twice
+    inline DynamicGraph<vertex_t, stats_props_t> statsGraph() {
+        return GraphBuilder<vertex_t, stats_props_t>()
+                .withEdge(0, 1, weighted<stats_props_t>(1))
+                .withEdge(1, 2, weighted<stats_props_t>(1))
+                .withEdge(0, 2, weighted<stats_props_t>(5));
+    }
+}
+
+TEST(Stats, Dijkstra) {
+    auto graph = test::statsGraph();
+    resetStats();
+    ASSERT_EQ(shortestPathLength(graph, 0, 2), 2);
+
+    if constexpr (STATS_ENABLED) {
+        ASSERT_EQ(stats().settled_vertices, 3);
+        ASSERT_EQ(stats().edge_relaxations, 6);
+        ASSERT_EQ(stats().queue_pushes, 4);
+        ASSERT_EQ(stats().queue_pops, 4);
+        ASSERT_EQ(stats().stale_pops, 1);
+    } else {
+        ASSERT_EQ(stats().queue_pushes, 0);
+        ASSERT_EQ(stats().settled_vertices, 0);
+    }
+
+    resetStats();
+    ASSERT_EQ(stats().queue_pushes, 0);
+}
+
+TEST(Stats, EdgeProbes) {
+    auto graph = test::statsGraph();
+    resetStats();
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(graph.isEdgeBelongs(0, 1));
+    }
+    ASSERT_EQ(stats().edge_probes, STATS_ENABLED ? 10 : 0);
+}
+
+TEST(Stats, ParallelWorkers) {
+    auto graph = test::statsGraph();
+    resetStats();
+    parallelFor(8, 4, [&](std::size_t) {
+        ASSERT_EQ(shortestPathLength(graph, 0, 2), 2);
+    });
+    ASSERT_EQ(stats().settled_vertices, STATS_ENABLED ? 8 * 3 : 0);
+    ASSERT_EQ(stats().stale_pops, STATS_ENABLED ? 8 : 0);
+}
@@ -19,6 +19,13 @@ namespace test {
     template<typename props_t>
     using Builder = GraphBuilder<vertex_t, props_t>;
 
+    template<typename props_t>
+    props_t weighted(decltype(props_t::weight) weight) {
+        props_t props;
+        props.weight = weight;
+        return props;
+    }
+
     template<typename props_t, std::invocable<vertex_t, vertex_t> Visitor>
     void iterateOverPossibleEdges(std::size_t vertex_count, Visitor&& visitor) {
         for (vertex_t i = 0; i < vertex_count; ++i) {
@@ -0,0 +1,85 @@
+#include "../TestsCommon.h"
+#include <ctpl/graph/algo.h>
+#include <ctpl/graph/IndexedGraph.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// replaces global operator new, so this file is built as an executable of its own
+
+namespace {
+    std::atomic<std::size_t> allocations = 0;
+
+    // out of line, so the compiler doesn't pair the malloc / free below with new / delete expressions
+    [[gnu::noinline]] void* countedAllocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* p = std::malloc(size == 0 ? 1 : size)) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    [[gnu::noinline]] void release(void* p) noexcept {
+        std::free(p);
+    }
+}
+
+// counts every allocation of the test binary, only differences are checked
+void* operator new(std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAllocate(size);
+}
+
+void operator delete(void* p) noexcept {
+    release(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    release(p);
+}
+
+void operator delete[](void* p) noexcept {
+    release(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    release(p);
+}
+
+TEST(SearchWorkspace, SteadyStateDoesNotAllocate) {
+    using props_t = EdgeProps<Undirected, Weighted<std::int32_t>>;
+    static constexpr std::size_t VERTEX_COUNT = 50;
+    auto matrix = test::generateRandomAdjacencyMatrix<props_t>(VERTEX_COUNT);
+    GraphBuilder<test::vertex_t, props_t> builder;
+    test::iterateOverPossibleEdges<props_t>(VERTEX_COUNT, [&](test::vertex_t u, test::vertex_t v) {
+        if (matrix[u][v]) {
+            props_t props;
+            props.weight = static_cast<std::int32_t>(test::rng()() % 101);
+            builder.withEdge(u, v, props);
+        }
+    });
+    IndexedGraph<test::vertex_t, props_t> graph = builder;
+    SearchWorkspace<test::vertex_t, props_t> workspace;
+    std::vector<test::vertex_t> path;
+
+    std::size_t visited = 0;
+    auto queries = [&]() {
+        for (test::vertex_t s = 0; s < 50; s++) {
+            shortestPath(graph, s, 49 - s, workspace, path);
+            shortestPathLength(graph, s, 49 - s, workspace);
+            distances(graph, s, workspace);
+            bfsCustom(graph, s, [&](test::vertex_t) { ++visited; }, workspace);
+            dfsCustom(graph, s, [&](test::vertex_t) { ++visited; }, workspace);
+            shortestPathsCustom(graph, s, [&](test::vertex_t, test::vertex_t) { ++visited; },
+                                [](test::vertex_t, std::int32_t) {}, workspace);
+        }
+    };
+    queries();
+    std::size_t before = allocations.load();
+    queries();
+    ASSERT_EQ(allocations.load(), before);
+    ASSERT_GT(visited, 0);
+}